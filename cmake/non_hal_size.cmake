@@ -0,0 +1,107 @@
+# Non HAL Library - the flash and RAM footprint of each function and object.
+#
+# It is run by the non_hal_size target:
+#   cmake -DNM=<nm> -DLIBRARY=<libnon_hal.a> -P non_hal_size.cmake
+# Code (T, t, W, w) and constants (R, r) take flash, initialized data (D, d)
+# takes flash and RAM, zeroed data (B, b, C) takes RAM. The report shows
+# the library before the link, --gc-sections of the project drops functions
+# which are never called.
+
+if(NOT NM OR NOT LIBRARY)
+  message(FATAL_ERROR "Usage: cmake -DNM=<nm> -DLIBRARY=<library> -P non_hal_size.cmake")
+endif()
+
+execute_process(COMMAND ${NM} --print-size --size-sort --radix=d ${LIBRARY}
+                OUTPUT_VARIABLE nm_output
+                RESULT_VARIABLE nm_result)
+if(NOT nm_result EQUAL 0)
+  message(FATAL_ERROR "${NM} failed on ${LIBRARY}")
+endif()
+
+# a right-aligned number in a column of 8 symbols
+function(non_hal_pad value out)
+  string(LENGTH "${value}" length)
+  math(EXPR spaces "8 - ${length}")
+  set(padded "${value}")
+  if(spaces GREATER 0)
+    string(REPEAT " " ${spaces} blank)
+    set(padded "${blank}${value}")
+  endif()
+  set(${out} "${padded}" PARENT_SCOPE)
+endfunction()
+
+# a row of the report: a name in a column of 60 symbols, flash and RAM
+function(non_hal_row name flash ram out)
+  string(LENGTH "${name}" length)
+  if(length LESS 60)
+    math(EXPR spaces "60 - ${length}")
+    string(REPEAT " " ${spaces} blank)
+    set(name "${name}${blank}")
+  endif()
+  non_hal_pad(${flash} flash_text)
+  non_hal_pad(${ram} ram_text)
+  set(${out} "  ${name} ${flash_text} ${ram_text}" PARENT_SCOPE)
+endfunction()
+
+string(REPLACE "\n" ";" nm_lines "${nm_output}")
+set(report "")
+set(module "")
+set(module_lines "")
+set(module_flash 0)
+set(module_ram 0)
+set(total_flash 0)
+set(total_ram 0)
+
+macro(non_hal_flush_module)
+  if(module AND module_lines)
+    # nm sorts the symbols by increasing size, the report starts with the largest
+    list(REVERSE module_lines)
+    non_hal_row("total" ${module_flash} ${module_ram} total_line)
+    string(APPEND report "${module}\n")
+    foreach(line IN LISTS module_lines)
+      string(APPEND report "${line}\n")
+    endforeach()
+    string(APPEND report "  ------------------------------------------------------------ -------- --------\n")
+    string(APPEND report "${total_line}\n\n")
+  endif()
+  set(module_lines "")
+  set(module_flash 0)
+  set(module_ram 0)
+endmacro()
+
+foreach(line IN LISTS nm_lines)
+  if(line MATCHES "^(.+\\.o(bj)?):$")
+    non_hal_flush_module()
+    get_filename_component(module "${CMAKE_MATCH_1}" NAME)
+  elseif(line MATCHES "^[0-9]+ 0*([0-9]+) ([A-Za-z]) (.+)$")
+    set(size ${CMAKE_MATCH_1})
+    set(type ${CMAKE_MATCH_2})
+    set(name ${CMAKE_MATCH_3})
+    set(flash 0)
+    set(ram 0)
+    if(type MATCHES "^[TtWwRr]$")
+      set(flash ${size})
+    elseif(type MATCHES "^[Dd]$")
+      set(flash ${size})
+      set(ram ${size})
+    elseif(type MATCHES "^[BbC]$")
+      set(ram ${size})
+    else()
+      continue()
+    endif()
+    math(EXPR module_flash "${module_flash} + ${flash}")
+    math(EXPR module_ram "${module_ram} + ${ram}")
+    math(EXPR total_flash "${total_flash} + ${flash}")
+    math(EXPR total_ram "${total_ram} + ${ram}")
+    non_hal_row("${name}" ${flash} ${ram} symbol_line)
+    list(APPEND module_lines "${symbol_line}")
+  endif()
+endforeach()
+non_hal_flush_module()
+
+non_hal_row("symbol" "flash" "ram" header_line)
+non_hal_row("library total" ${total_flash} ${total_ram} total_line)
+message("Non HAL library footprint, bytes (${LIBRARY})\n"
+        "${header_line}\n\n"
+        "${report}"
+        "${total_line}")
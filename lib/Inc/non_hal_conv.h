@@ -39,9 +39,34 @@
 #include "non_hal_def.h"
 
 /* Types ---------------------------------------------------------------------*/
+
+/**@addtogroup Non_HAL_Converters_to_string
+  * @{
+  */
+
+/**
+  * @brief Notations of a float string
+  */
+typedef enum
+{
+  NON_HAL_CON_FIXED      = 0x0U,  /*!<Digits without an exponent (123.45)*/
+  NON_HAL_CON_SCIENTIFIC = 0x1U,  /*!<One digit before the point and an exponent (1.2345e+2)*/
+  NON_HAL_CON_AUTO       = 0x2U   /*!<Fixed for moderate values, scientific otherwise*/
+} Non_HAL_CON_Notation;
+
+/**
+  * @}
+  */
+
 /* Variables -----------------------------------------------------------------*/
 /* Constants -----------------------------------------------------------------*/
 /* Macros --------------------------------------------------------------------*/
+
+/** @brief A maximum number of digits after the decimal point for
+  *        Non_HAL_CON_Float_to_DecString_Format()
+  */
+#define NON_HAL_CON_FLOAT_PRECISION   9U
+
 /* Functions -----------------------------------------------------------------*/
 
 /**@defgroup Non_HAL_Converters_to_string Converters to a string
@@ -50,24 +75,70 @@
   */
 
 NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_8bit(int8_t data, uint8_t *bitstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_16bit(int16_t data, uint8_t *bitstr, uint8_t sizebuf);
 NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_32bit(int32_t data, uint8_t *bitstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_64bit(int64_t data, uint8_t *bitstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_8bit(uint8_t data, uint8_t *hexstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_16bit(uint16_t data, uint8_t *hexstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_32bit(uint32_t data, uint8_t *hexstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_64bit(uint64_t data, uint8_t *hexstr, uint8_t sizebuf);
 NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_8bit(uint8_t data, uint8_t *decstr, uint8_t sizebuf);
 NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_8bit(int8_t data, uint8_t *decstr, uint8_t sizebuf);
 NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_32bit(uint32_t data, uint8_t *decstr, uint8_t sizebuf);
 NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_32bit(int32_t data, uint8_t *decstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_64bit(uint64_t data, uint8_t *decstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_64bit(int64_t data, uint8_t *decstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_Padded_32bit(uint32_t data, uint8_t width, uint8_t *decstr,
+                                                                  uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_Padded_32bit(int32_t data, uint8_t width, uint8_t *decstr,
+                                                                 uint8_t sizebuf);
 NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString_Shortest(float data, uint8_t *decstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString_Format(float data, uint8_t precision, Non_HAL_CON_Notation notation,
+                                                            uint8_t *decstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_Double_to_DecString_Shortest(double data, uint8_t *decstr, uint8_t sizebuf);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_Array_to_DecString_32bit(const uint32_t *data, uint32_t count, uint8_t separator,
+                                                                 uint8_t *decstr, uint32_t sizebuf, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_Array_to_DecString_32bit(const int32_t *data, uint32_t count, uint8_t separator,
+                                                                uint8_t *decstr, uint32_t sizebuf, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_Array_to_HexString_8bit(const uint8_t *data, uint32_t count, uint8_t separator,
+                                                                uint8_t *hexstr, uint32_t sizebuf, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_Array_to_HexString_32bit(const uint32_t *data, uint32_t count, uint8_t separator,
+                                                                 uint8_t *hexstr, uint32_t sizebuf, uint32_t *length);
 
 /**
   * @}
   */
 
-/**@defgroup Non_HAL_Converters_to_string Converters to a string
-  * @brief Converters from numeric types to a character string
+/**@defgroup Non_HAL_Converters_from_string Converters from a string
+  * @brief Converters from a character string to numeric types
   * @{
   */
 
 NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_8bit(uint8_t *bitstr, int8_t *data_out);
+NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_16bit(uint8_t *bitstr, int16_t *data_out);
 NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_32bit(uint8_t *bitstr, int32_t *data_out);
+NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_64bit(uint8_t *bitstr, int64_t *data_out);
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_8bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                         uint8_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_16bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                          uint16_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_32bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                          uint32_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_64bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                          uint64_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_UInt_32bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                          uint32_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Int_32bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                         int32_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Float(const uint8_t *decstr, uint32_t sizebuf,
+                                                     float *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_UInt_64bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                          uint64_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Int_64bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                         int64_t *data_out, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Double(const uint8_t *decstr, uint32_t sizebuf,
+                                                      double *data_out, uint32_t *length);
 
 /**
   * @}
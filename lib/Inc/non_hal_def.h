@@ -36,6 +36,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdbool.h>
+#include <stdint.h>
 
 /* Types ---------------------------------------------------------------------*/
 
@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_disp.h
+  * @brief      Header for non_hal_disp.c file.
+  *             This file defines functions to update numeric fields of
+  *             a display incrementally.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_DISP_H_
+#define NON_HAL_DISP_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include <stdint.h>
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Disp_Structure Display field structure
+  * @brief Structure for a numeric field of a display
+  * @{
+  */
+
+/**
+  * @brief Structure with a state of a numeric field of a display. The field
+  *        keeps the symbols on the display and a span of symbols which
+  *        changed since the last redraw.
+  */
+typedef struct
+{
+  uint8_t *text;               /*!<Symbols of the field (width symbols and \0)*/
+  uint8_t width;               /*!<A number of symbols of the field*/
+  uint8_t decimals;            /*!<A number of digits after the point*/
+  uint8_t first;               /*!<The first changed symbol*/
+  uint8_t end;                 /*!<A symbol after the last changed symbol (first == end if nothing changed)*/
+  uint32_t magnitude;          /*!<An absolute value of the shown number*/
+  bool negative;               /*!<true if the shown number is negative*/
+  bool valid;                  /*!<true if the field shows a number (not after Init or an overflow)*/
+}Non_HAL_Disp_Field_Struct;
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A maximum number of symbols of a field
+  */
+#define NON_HAL_DISP_MAX_WIDTH     16U
+
+/** @brief A maximum number of digits after the point
+  */
+#define NON_HAL_DISP_MAX_DECIMALS  9U
+
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Disp Display field
+  * @brief An incremental update of numeric fields of a display
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Non_HAL_Disp_Init(Non_HAL_Disp_Field_Struct *pField, uint8_t *text, uint8_t width,
+                                        uint8_t decimals);
+NON_HAL_StatusTypeDef Non_HAL_Disp_Set_UInt(Non_HAL_Disp_Field_Struct *pField, uint32_t data);
+NON_HAL_StatusTypeDef Non_HAL_Disp_Set_Int(Non_HAL_Disp_Field_Struct *pField, int32_t data);
+NON_HAL_StatusTypeDef Non_HAL_Disp_Set_Float(Non_HAL_Disp_Field_Struct *pField, float data);
+uint8_t Non_HAL_Disp_Take_Dirty(Non_HAL_Disp_Field_Struct *pField, uint8_t *first);
+void Non_HAL_Disp_Invalidate(Non_HAL_Disp_Field_Struct *pField);
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_DISP_H_ */
@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_filter.h
+  * @brief      Header for non_hal_filter.c file.
+  *             This file defines functions to filter data with the moving
+  *             average, the exponential moving average, the sliding median
+  *             and the alpha-beta filters.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_FILTER_H_
+#define NON_HAL_FILTER_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Filter_Structure Filters structures
+  * @brief Structures for the low-cost filters
+  * @{
+  */
+
+/**
+  * @brief Structure with parameters for the moving average filter
+  */
+typedef struct
+{
+  float *buffer;               /*!<Last values (a window)*/
+  uint32_t size;               /*!<A size of the window*/
+  uint32_t index;              /*!<A position of the oldest value in the window*/
+  uint32_t count;              /*!<A number of values in the window*/
+  float sum;                   /*!<A sum of values in the window*/
+  float lap;                   /*!<A sum of values since the index was 0*/
+  float scale;                 /*!<1 / size*/
+}Filter_Average_Struct;
+
+/**
+  * @brief Structure with parameters for the exponential moving average filter
+  */
+typedef struct
+{
+  float alpha;                 /*!<A smoothing factor*/
+  float lastestimate;          /*!<A previous value*/
+  uint32_t primed;             /*!<1 after the first value*/
+}Filter_EMA_Struct;
+
+/**
+  * @brief Structure with parameters for the sliding median filter
+  */
+typedef struct
+{
+  float *buffer;               /*!<Last values (a window)*/
+  int16_t *pos;                /*!<Positions of values of the window in the heap*/
+  int16_t *heap;               /*!<The heap (0 is the median, < 0 is the max-heap, > 0 is the min-heap)*/
+  int32_t size;                /*!<A size of the window*/
+  int32_t index;               /*!<A position of the oldest value in the window*/
+  int32_t count;               /*!<A number of values in the window*/
+}Filter_Median_Struct;
+
+/**
+  * @brief Structure with parameters for the alpha-beta filter
+  */
+typedef struct
+{
+  float alpha;                 /*!<A gain of the value*/
+  float beta;                  /*!<A gain of the rate of change divided by the sample period*/
+  float dt;                    /*!<A sample period*/
+  float lastestimate;          /*!<A previous value*/
+  float speed;                 /*!<A rate of change of values*/
+  uint32_t primed;             /*!<1 after the first value*/
+}Filter_Alpha_Beta_Struct;
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A maximum size of the window of the sliding median filter
+  */
+#define FILT_MED_MAX_SIZE          32767U
+
+/** @brief A number of int16_t in an index buffer of the sliding median filter
+  *        with the window of SIZE values
+  */
+#define FILT_MED_INDEX_SIZE(SIZE)  (2U * (SIZE))
+
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Filter Filters
+  * @brief A filtering data with the low-cost filters
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Filt_Avg_Init(Filter_Average_Struct *pData, float *pBuffer, uint32_t size);
+float Filt_Avg(Filter_Average_Struct *pData, float value);
+NON_HAL_StatusTypeDef Filt_Avg_Block(Filter_Average_Struct *pData, const float *in, float *out, size_t n);
+
+NON_HAL_StatusTypeDef Filt_EMA_Init(Filter_EMA_Struct *pData, float Alpha);
+float Filt_EMA(Filter_EMA_Struct *pData, float value);
+NON_HAL_StatusTypeDef Filt_EMA_Block(Filter_EMA_Struct *pData, const float *in, float *out, size_t n);
+
+NON_HAL_StatusTypeDef Filt_Med_Init(Filter_Median_Struct *pData, float *pBuffer, int16_t *pIndex, uint32_t size);
+float Filt_Med(Filter_Median_Struct *pData, float value);
+NON_HAL_StatusTypeDef Filt_Med_Block(Filter_Median_Struct *pData, const float *in, float *out, size_t n);
+
+NON_HAL_StatusTypeDef Filt_AB_Init(Filter_Alpha_Beta_Struct *pData, float Alpha, float Beta, float Dt);
+float Filt_AB(Filter_Alpha_Beta_Struct *pData, float value);
+NON_HAL_StatusTypeDef Filt_AB_Block(Filter_Alpha_Beta_Struct *pData, const float *in, float *out, size_t n);
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_FILTER_H_ */
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_kalmbank.h
+  * @brief      Header for non_hal_kalmbank.c file.
+  *             This file defines functions to filter several channels of data
+  *             with a bank of the fast Kalman filters.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_KALMBANK_H_
+#define NON_HAL_KALMBANK_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include "non_hal_kalmfilter.h"
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Kalman_bank_Structure Kalman filter bank structure
+  * @brief Structure for the bank of the fast Kalman filters
+  * @{
+  */
+
+/**
+  * @brief Kernels which can update the bank of the fast Kalman filters
+  */
+typedef enum
+{
+  FILT_KALM_BANK_SCALAR = 0x0U,  /*!<The portable kernel*/
+  FILT_KALM_BANK_SSE    = 0x1U,  /*!<The SSE kernel (4 channels per step)*/
+  FILT_KALM_BANK_AVX2   = 0x2U,  /*!<The AVX2 kernel (8 channels per step)*/
+  FILT_KALM_BANK_NEON   = 0x3U   /*!<The NEON kernel (4 channels per step)*/
+} Filter_Kalman_Bank_Kernel;
+
+/**
+  * @brief Structure with parameters for the bank of the fast Kalman filters.
+  *        Parameters of the channels are stored as parallel arrays.
+  */
+typedef struct
+{
+  float *errmeasure;                  /*!<Predicted error measures of channels*/
+  float *errestimate;                 /*!<Error estimates of channels*/
+  float *speed;                       /*!<Rates of change of values of channels*/
+  float *lastestimate;                /*!<Previous values of channels*/
+  float *kalmangain;                  /*!<The Kalman Gains of channels*/
+  uint32_t channels;                  /*!<A number of channels*/
+  Filter_Kalman_Bank_Kernel kernel;   /*!<The kernel chosen by Filt_Kalm_Bank_Init*/
+}Filter_Kalman_Bank_Struct;
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of floats in a work buffer for a bank with CHANNELS channels
+  */
+#define FILT_KALM_BANK_WORK_SIZE(CHANNELS)   (5U * (CHANNELS))
+
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Kalman_bank Kalman filter bank
+  * @brief A filtering several channels of data with the fast Kalman filters
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Init(Filter_Kalman_Bank_Struct *pBank, float *pWork, uint32_t channels,
+                                          float ErrMeasure, float Speed);
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Set_Kernel(Filter_Kalman_Bank_Struct *pBank, Filter_Kalman_Bank_Kernel kernel);
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Load(Filter_Kalman_Bank_Struct *pBank, uint32_t channel,
+                                          const Filter_Kalman_Struct *pData);
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Store(const Filter_Kalman_Bank_Struct *pBank, uint32_t channel,
+                                           Filter_Kalman_Struct *pData);
+void Filt_Kalm_Bank(Filter_Kalman_Bank_Struct *pBank, const float *in, float *out);
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_KALMBANK_H_ */
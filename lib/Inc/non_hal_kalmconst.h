@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_kalmconst.h
+  * @brief      This file defines the fast Kalman filter with the error measure
+  *             and the speed known at compile time.
+  *
+  *             FILT_KALM_CONST_DEFINE generates a structure and static inline
+  *             functions for one set of parameters, so the compiler folds the
+  *             parameters into the code and keeps the state in registers when
+  *             the filter is inlined into a loop. The state isn't volatile.
+  *             The float filter is bit-identical to Filt_Kalm with the same
+  *             parameters. The state can be moved to and from
+  *             Filter_Kalman_Struct, so the filter can be mixed with the
+  *             C functions of non_hal_kalmfilter.c.
+  *
+  *             example:
+  *             @code
+  *             FILT_KALM_CONST_DEFINE(Filt_Kalm_Temp, float, 2.0f, 0.01f)
+  *
+  *             Filt_Kalm_Temp_Struct temp;
+  *             Filt_Kalm_Temp_Init(&temp);
+  *             out = Filt_Kalm_Temp(&temp, in);
+  *             @endcode
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_KALMCONST_H_
+#define NON_HAL_KALMCONST_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include "non_hal_kalmfilter.h"
+#include <stddef.h>
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Kalman_const Kalman filter with constant parameters
+  * @brief A filtering data with the fast Kalman filter with parameters known
+  *        at compile time
+  * @{
+  */
+
+/**
+  * @brief  The macro to define the fast Kalman filter with constant parameters.
+  *         It defines:
+  *           - NAME_Struct - a structure with the state of the filter;
+  *           - NAME_Init(pData) - to initial the state;
+  *           - NAME(pData, value) - to filter one value;
+  *           - NAME_Block(pData, in, out, n) - to filter an array of values
+  *             (in == out is supported);
+  *           - NAME_Load(pData, pSrc) / NAME_Store(pData, pDst) - to move the
+  *             state from / to a Filter_Kalman_Struct structure.
+  * @param  NAME a name of the filter
+  * @param  TYPE a type of values and of the state (float or double)
+  * @param  ERRMEASURE a predicted input date standard deviation (> 0)
+  * @param  SPEED a rate of change of output values (from 0,001 to 1)
+  */
+#define FILT_KALM_CONST_DEFINE(NAME, TYPE, ERRMEASURE, SPEED)                                   \
+typedef struct                                                                                  \
+{                                                                                               \
+  TYPE errestimate;                                                                             \
+  TYPE lastestimate;                                                                            \
+  TYPE kalmangain;                                                                              \
+}NAME##_Struct;                                                                                 \
+                                                                                                \
+static inline void NAME##_Init(NAME##_Struct *pData)                                            \
+{                                                                                               \
+  pData->errestimate = (TYPE)(ERRMEASURE);                                                      \
+  pData->lastestimate = 0;                                                                      \
+  pData->kalmangain = 0;                                                                        \
+}                                                                                               \
+                                                                                                \
+static inline TYPE NAME(NAME##_Struct *pData, TYPE value)                                       \
+{                                                                                               \
+  TYPE errestimate = pData->errestimate;                                                        \
+  TYPE lastestimate = pData->lastestimate;                                                      \
+  TYPE kalmangain = errestimate / (errestimate + (TYPE)(ERRMEASURE));                           \
+  TYPE currentestimate = lastestimate + kalmangain * (value - lastestimate);                    \
+  TYPE change = lastestimate - currentestimate;                                                 \
+  change = (change < 0) ? -change : change;                                                     \
+  pData->errestimate = ((TYPE)1 - kalmangain) * errestimate + change * (TYPE)(SPEED);           \
+  pData->lastestimate = currentestimate;                                                        \
+  pData->kalmangain = kalmangain;                                                               \
+  return currentestimate;                                                                       \
+}                                                                                               \
+                                                                                                \
+static inline void NAME##_Block(NAME##_Struct *pData, const TYPE *in, TYPE *out, size_t n)      \
+{                                                                                               \
+  NAME##_Struct state = *pData;                                                                 \
+  for(size_t i = 0; i < n; i++)                                                                 \
+  {                                                                                             \
+    out[i] = NAME(&state, in[i]);                                                               \
+  }                                                                                             \
+  *pData = state;                                                                               \
+}                                                                                               \
+                                                                                                \
+static inline void NAME##_Load(NAME##_Struct *pData, const Filter_Kalman_Struct *pSrc)          \
+{                                                                                               \
+  pData->errestimate = (TYPE)pSrc->errestimate;                                                 \
+  pData->lastestimate = (TYPE)pSrc->lastestimate;                                               \
+  pData->kalmangain = (TYPE)pSrc->kalmangain;                                                   \
+}                                                                                               \
+                                                                                                \
+static inline void NAME##_Store(const NAME##_Struct *pData, Filter_Kalman_Struct *pDst)         \
+{                                                                                               \
+  pDst->errmeasure = (float)(ERRMEASURE);                                                       \
+  pDst->errestimate = (float)pData->errestimate;                                                \
+  pDst->speed = (float)(SPEED);                                                                 \
+  pDst->lastestimate = (float)pData->lastestimate;                                              \
+  pDst->kalmangain = (float)pData->kalmangain;                                                  \
+}
+
+/**
+  * @}
+  */
+
+/* Functions -----------------------------------------------------------------*/
+
+#endif /* NON_HAL_KALMCONST_H_ */
@@ -38,6 +38,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "non_hal_def.h"
+#include <stddef.h>
 
 /* Types ---------------------------------------------------------------------*/
 
@@ -58,6 +59,86 @@ typedef struct
 	volatile float kalmangain;   /*!<The Kalman Gain*/
 }Filter_Kalman_Struct;
 
+/**
+  * @brief Structure with main parameters for the fast Kalman filter
+  *        in the Q15 format
+  */
+typedef struct
+{
+  int32_t errmeasure;          /*!<A predicted error measure (Q30, > 0)*/
+  int32_t errestimate;         /*!<A error estimate (Q30)*/
+  int16_t speed;               /*!<A rate of change of values (Q15)*/
+  int16_t lastestimate;        /*!<A previous value (Q15)*/
+  int16_t kalmangain;          /*!<The Kalman Gain (Q15)*/
+}Filter_Kalman_Q15_Struct;
+
+/**
+  * @brief Structure with main parameters for the fast Kalman filter
+  *        in the Q31 format
+  */
+typedef struct
+{
+  int32_t errmeasure;          /*!<A predicted error measure (Q31, > 0)*/
+  int32_t errestimate;         /*!<A error estimate (Q31)*/
+  int32_t speed;               /*!<A rate of change of values (Q31)*/
+  int32_t lastestimate;        /*!<A previous value (Q31)*/
+  int32_t kalmangain;          /*!<The Kalman Gain (Q31)*/
+}Filter_Kalman_Q31_Struct;
+
+/**
+  * @brief Structure with parameters for the fast Kalman filter which freezes
+  *        the converged Kalman Gain
+  */
+typedef struct
+{
+  Filter_Kalman_Struct filter; /*!<The fast Kalman filter*/
+  float epsilon;               /*!<A relative band of the Gain treated as converged*/
+  float jump;                  /*!<An innovation magnitude which unfreezes the Gain*/
+  float anchor;                /*!<The Gain the band is centred on*/
+  float errlow;                /*!<The lowest error estimate for the frozen Gain*/
+  float errhigh;               /*!<The highest error estimate for the frozen Gain*/
+  uint32_t stable;             /*!<A number of successive samples with the Gain in the band*/
+  uint32_t frozen;             /*!<1 if the Gain is frozen, 0 otherwise*/
+  uint32_t fullcount;          /*!<A number of samples filtered with the division*/
+  uint32_t fastcount;          /*!<A number of samples filtered with the frozen Gain*/
+  uint32_t freezes;            /*!<A number of switches to the frozen Gain*/
+  uint32_t thaws;              /*!<A number of switches back to the division*/
+}Filter_Kalman_Adaptive_Struct;
+
+/**
+  * @brief Structure with parameters for the fast Kalman filter which rejects
+  *        outliers, NaN and infinite samples
+  */
+typedef struct
+{
+  Filter_Kalman_Struct filter; /*!<The fast Kalman filter*/
+  float gate2;                 /*!<The square of the gate (in standard deviations of the innovation)*/
+  uint32_t reacquire;          /*!<A number of successive outliers after which the filter restarts*/
+  uint32_t run;                /*!<A number of successive outliers*/
+  uint32_t primed;             /*!<1 after the first finite value*/
+  uint32_t accepted;           /*!<A number of samples taken by the filter*/
+  uint32_t rejected;           /*!<A number of outliers*/
+  uint32_t invalid;            /*!<A number of NaN and infinite samples*/
+  uint32_t reacquired;         /*!<A number of restarts*/
+}Filter_Kalman_Gated_Struct;
+
+/**
+  * @brief Structure with parameters for the fast Kalman filter which takes
+  *        one decimated value (a CIC prefilter) per Factor input samples
+  */
+typedef struct
+{
+  Filter_Kalman_Struct filter; /*!<The fast Kalman filter of decimated values*/
+  float sum;                   /*!<A sum of samples of the current output (the first integrator)*/
+  float integral;              /*!<A sum of sums of samples (the second integrator, order 2)*/
+  float lastpart;              /*!<A part of the previous samples in the current output (order 2)*/
+  float scale;                 /*!<1 / a sum of weights of the samples of an output*/
+  uint32_t factor;             /*!<A number of input samples per output*/
+  uint32_t order;              /*!<An order of the CIC prefilter (1 - a mean, 2 - a triangle)*/
+  uint32_t count;              /*!<A number of samples of the current output*/
+  uint32_t primed;             /*!<1 after the first output, 0 otherwise*/
+}Filter_Kalman_Decim_Struct;
+
 /**
   * @}
   */
@@ -65,6 +146,19 @@ typedef struct
 /* Variables -----------------------------------------------------------------*/
 /* Constants -----------------------------------------------------------------*/
 /* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of successive samples with the Kalman Gain in the band
+  *        after which Filt_Kalm_Adaptive() freezes the Gain
+  */
+#ifndef FILT_KALM_ADAPTIVE_SETTLE
+#define FILT_KALM_ADAPTIVE_SETTLE   32U
+#endif
+
+/** @brief A number of output values of Filt_Kalm_Decim_Block() for N input
+  *        samples and a decimation factor FACTOR (the largest possible one)
+  */
+#define FILT_KALM_DECIM_OUT_SIZE(N, FACTOR)   ((N) / (FACTOR) + 1U)
+
 /* Functions -----------------------------------------------------------------*/
 
 /**@defgroup Non_HAL_Kalman_filter Kalman filter
@@ -74,6 +168,31 @@ typedef struct
 
 NON_HAL_StatusTypeDef Filt_Kalm_Init(Filter_Kalman_Struct *pData, float ErrMeasure, float Speed);
 float Filt_Kalm(Filter_Kalman_Struct *pData, float value);
+NON_HAL_StatusTypeDef Filt_Kalm_Block(Filter_Kalman_Struct *pData, const float *in, float *out, size_t n);
+
+NON_HAL_StatusTypeDef Filt_Kalm_Init_Q15(Filter_Kalman_Q15_Struct *pData, int16_t ErrMeasure, int16_t Speed);
+int16_t Filt_Kalm_Q15(Filter_Kalman_Q15_Struct *pData, int16_t value);
+NON_HAL_StatusTypeDef Filt_Kalm_Init_Q31(Filter_Kalman_Q31_Struct *pData, int32_t ErrMeasure, int32_t Speed);
+int32_t Filt_Kalm_Q31(Filter_Kalman_Q31_Struct *pData, int32_t value);
+
+NON_HAL_StatusTypeDef Filt_Kalm_Adaptive_Init(Filter_Kalman_Adaptive_Struct *pData, float ErrMeasure, float Speed,
+                                              float Epsilon, float Jump);
+float Filt_Kalm_Adaptive(Filter_Kalman_Adaptive_Struct *pData, float value);
+NON_HAL_StatusTypeDef Filt_Kalm_Adaptive_Block(Filter_Kalman_Adaptive_Struct *pData, const float *in, float *out,
+                                               size_t n);
+void Filt_Kalm_Adaptive_Reset_Stats(Filter_Kalman_Adaptive_Struct *pData);
+
+NON_HAL_StatusTypeDef Filt_Kalm_Gated_Init(Filter_Kalman_Gated_Struct *pData, float ErrMeasure, float Speed,
+                                           float Gate, uint32_t Reacquire);
+float Filt_Kalm_Gated(Filter_Kalman_Gated_Struct *pData, float value);
+NON_HAL_StatusTypeDef Filt_Kalm_Gated_Block(Filter_Kalman_Gated_Struct *pData, const float *in, float *out, size_t n);
+void Filt_Kalm_Gated_Reset_Stats(Filter_Kalman_Gated_Struct *pData);
+
+NON_HAL_StatusTypeDef Filt_Kalm_Decim_Init(Filter_Kalman_Decim_Struct *pData, float ErrMeasure, float Speed,
+                                           uint32_t Factor, uint32_t Order);
+uint32_t Filt_Kalm_Decim(Filter_Kalman_Decim_Struct *pData, float value, float *out);
+NON_HAL_StatusTypeDef Filt_Kalm_Decim_Block(Filter_Kalman_Decim_Struct *pData, const float *in, size_t n,
+                                            float *out, size_t *length);
 
 /**
   * @}
@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_kalmmatrix.h
+  * @brief      Header for non_hal_kalmmatrix.c file.
+  *             This file defines functions of the linear Kalman filter with
+  *             a state vector and a measurement vector (from 1 to 9 values).
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_KALMMATRIX_H_
+#define NON_HAL_KALMMATRIX_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include <stdint.h>
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Kalman_matrix_Structure Matrix Kalman filter structure
+  * @brief Structure for the linear Kalman filter
+  * @{
+  */
+
+/**
+  * @brief Structure with parameters of the linear Kalman filter. All matrices
+  *        are stored by rows in the work buffer given to Filt_Kalm_Matrix_Init,
+  *        the model (F, Q, H, R) and the state (x, P) are written directly.
+  */
+typedef struct
+{
+  uint32_t states;        /*!<A number of values of the state (N)*/
+  uint32_t measurements;  /*!<A number of values of a measurement (M)*/
+  float *x;               /*!<The state estimate (N)*/
+  float *P;               /*!<The covariance of the state estimate (N x N)*/
+  float *F;               /*!<The state transition model (N x N)*/
+  float *Q;               /*!<The covariance of the process noise (N x N)*/
+  float *H;               /*!<The observation model (M x N)*/
+  float *R;               /*!<The covariance of the measurement noise (M x M)*/
+  float *work;            /*!<Temporary matrices of the predict and the update steps*/
+}Filter_Kalman_Matrix_Struct;
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+
+/** @brief A maximum number of values of the state and of a measurement
+  */
+#define FILT_KALM_MATRIX_MAX_SIZE   9U
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of floats in a work buffer for a filter with N values of
+  *        the state and M values of a measurement
+  */
+#define FILT_KALM_MATRIX_WORK_SIZE(N, M)   ((N) + 3U * (N) * (N) + (M) * (N) + (M) * (M) + \
+                                            (M) + (M) * (M) + 2U * (N) * (M) + 2U * (N) * (N))
+
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Kalman_matrix Matrix Kalman filter
+  * @brief A filtering data with the linear Kalman filter
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Init(Filter_Kalman_Matrix_Struct *pData, float *pWork,
+                                            uint32_t states, uint32_t measurements);
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Predict(Filter_Kalman_Matrix_Struct *pData);
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Update(Filter_Kalman_Matrix_Struct *pData, const float *z);
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix(Filter_Kalman_Matrix_Struct *pData, const float *z);
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_KALMMATRIX_H_ */
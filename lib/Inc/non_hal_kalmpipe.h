@@ -0,0 +1,213 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_kalmpipe.h
+  * @brief      Header for non_hal_kalmpipe.c file.
+  *             This file defines functions to filter channels of data fed
+  *             by several threads of a POSIX host with the fast Kalman
+  *             filters on a pool of worker threads.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_KALMPIPE_H_
+#define NON_HAL_KALMPIPE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include "non_hal_kalmfilter.h"
+
+/** @brief 1 to build the pipeline of the fast Kalman filters. It needs C11
+  *        atomics and POSIX threads, so it is built on POSIX hosts only if it
+  *        isn't defined by the project.
+  * @note  The header isn't included by non_hal_lib.h, the pipeline is used
+  *        with #include "non_hal_kalmpipe.h". The types of the pipeline are C11
+  *        (_Atomic, _Alignas), C++ code doesn't see them.
+  */
+#ifndef NON_HAL_KALM_PIPE
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__STDC_NO_ATOMICS__) && !defined(__cplusplus)
+#define NON_HAL_KALM_PIPE   1
+#else
+#define NON_HAL_KALM_PIPE   0
+#endif
+#endif
+
+#if NON_HAL_KALM_PIPE
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A maximum number of worker threads of a pipeline
+  */
+#ifndef FILT_KALM_PIPE_MAX_WORKERS
+#define FILT_KALM_PIPE_MAX_WORKERS   64U
+#endif
+
+/** @brief A number of empty polls of a queue before a worker sleeps
+  */
+#ifndef FILT_KALM_PIPE_SPIN
+#define FILT_KALM_PIPE_SPIN   256U
+#endif
+
+/** @brief A time an idle worker sleeps for, ns
+  */
+#ifndef FILT_KALM_PIPE_IDLE_NS
+#define FILT_KALM_PIPE_IDLE_NS   20000U
+#endif
+
+/** @brief A size of a cache line, the fields written by different threads
+  *        are aligned to it
+  */
+#ifndef FILT_KALM_PIPE_LINE
+#define FILT_KALM_PIPE_LINE   64U
+#endif
+
+/** @brief A number of Filter_Kalman_Pipe_Cell in a cells buffer for WORKERS
+  *        workers with queues of DEPTH samples
+  */
+#define FILT_KALM_PIPE_CELLS_SIZE(WORKERS, DEPTH)     ((WORKERS) * (DEPTH))
+
+/** @brief A number of Filter_Kalman_Pipe_Sample in a results buffer for
+  *        WORKERS workers with batches of BATCH samples
+  */
+#define FILT_KALM_PIPE_RESULTS_SIZE(WORKERS, BATCH)   ((WORKERS) * (BATCH))
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Kalman_pipe_Structure Kalman filter pipeline structure
+  * @brief Structure for the pipeline of the fast Kalman filters
+  * @{
+  */
+
+/**
+  * @brief A sample of a channel
+  */
+typedef struct
+{
+  uint32_t channel;            /*!<A number of the channel*/
+  float value;                 /*!<A value*/
+}Filter_Kalman_Pipe_Sample;
+
+/**
+  * @brief A cell of a queue
+  */
+typedef struct
+{
+  atomic_size_t sequence;      /*!<A position the cell is ready for*/
+  Filter_Kalman_Pipe_Sample sample;  /*!<A sample*/
+}Filter_Kalman_Pipe_Cell;
+
+/**
+  * @brief A function which receives a batch of filtered samples of a worker.
+  *        Workers call it concurrently, each one with its own results.
+  */
+typedef void (*Filter_Kalman_Pipe_Callback)(void *context, uint32_t worker,
+                                            const Filter_Kalman_Pipe_Sample *results, uint32_t count);
+
+struct Filter_Kalman_Pipe_Struct;
+
+/**
+  * @brief Structure of a worker with its queue
+  * @note  The fields are grouped by the threads which write them, each group
+  *        on its own cache lines: head is written by producers, the next
+  *        group is written only by Filt_Kalm_Pipe_Init() and
+  *        Filt_Kalm_Pipe_Start() and is read by producers and the worker,
+  *        tail and the counters are written by the worker only.
+  */
+typedef struct
+{
+  _Alignas(FILT_KALM_PIPE_LINE) atomic_size_t head;  /*!<A position to push at (producers)*/
+  _Alignas(FILT_KALM_PIPE_LINE) Filter_Kalman_Pipe_Cell *cells;  /*!<Cells of the queue*/
+  Filter_Kalman_Pipe_Sample *results;                /*!<A buffer for a batch of results*/
+  struct Filter_Kalman_Pipe_Struct *pipe;            /*!<The pipeline of the worker*/
+  pthread_t thread;                                  /*!<The thread of the worker*/
+  uint32_t index;                                    /*!<A number of the worker*/
+  _Alignas(FILT_KALM_PIPE_LINE) size_t tail;         /*!<A position to pop from (the worker)*/
+  uint64_t processed;                                /*!<A number of filtered samples*/
+  uint64_t batches;                                  /*!<A number of calls of the callback*/
+}Filter_Kalman_Pipe_Worker;
+
+/**
+  * @brief Structure with parameters for the pipeline of the fast Kalman
+  *        filters
+  * @note  The parameters after the workers are only read while the pipeline
+  *        runs, dropped is written by producers and has a cache line of its
+  *        own.
+  * @note  The structure is large (more than 12 KB) and aligned to
+  *        FILT_KALM_PIPE_LINE bytes. It must be a static or a global
+  *        variable or be allocated with
+  *        aligned_alloc(FILT_KALM_PIPE_LINE, sizeof(Filter_Kalman_Pipe_Struct)),
+  *        malloc() only guarantees 16 bytes.
+  */
+typedef struct Filter_Kalman_Pipe_Struct
+{
+  Filter_Kalman_Pipe_Worker worker[FILT_KALM_PIPE_MAX_WORKERS];  /*!<Workers*/
+  _Alignas(FILT_KALM_PIPE_LINE) Filter_Kalman_Struct *filters;  /*!<Filters of channels*/
+  uint32_t channels;                     /*!<A number of channels*/
+  uint32_t workers;                      /*!<A number of workers*/
+  uint32_t range;                        /*!<A number of channels of one worker*/
+  uint32_t depth;                        /*!<A number of samples in a queue (2^n)*/
+  uint32_t batch;                        /*!<A maximum number of results in a batch*/
+  int32_t cpu;                           /*!<The first CPU for the workers, -1 for any*/
+  Filter_Kalman_Pipe_Callback callback;  /*!<The function which receives results*/
+  void *context;                         /*!<A parameter for the callback*/
+  atomic_uint running;                   /*!<1 while the workers run*/
+  _Alignas(FILT_KALM_PIPE_LINE) atomic_ulong dropped;  /*!<A number of samples rejected by full queues*/
+}Filter_Kalman_Pipe_Struct;
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Kalman_pipe Kalman filter pipeline
+  * @brief A filtering channels of data fed by several threads with the fast
+  *        Kalman filters
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Init(Filter_Kalman_Pipe_Struct *pPipe, Filter_Kalman_Struct *pFilters,
+                                          uint32_t channels, uint32_t workers,
+                                          Filter_Kalman_Pipe_Cell *pCells, uint32_t depth,
+                                          Filter_Kalman_Pipe_Sample *pResults, uint32_t batch,
+                                          Filter_Kalman_Pipe_Callback callback, void *context);
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Start(Filter_Kalman_Pipe_Struct *pPipe, int32_t cpu);
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Push(Filter_Kalman_Pipe_Struct *pPipe, uint32_t channel, float value);
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Stop(Filter_Kalman_Pipe_Struct *pPipe);
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_KALM_PIPE */
+
+#endif /* NON_HAL_KALMPIPE_H_ */
@@ -39,37 +39,22 @@
 #define NON_HAL_LIB_H_
 
 /* Includes ------------------------------------------------------------------*/
-#include "stm32f4xx_hal.h"
+#include "non_hal_port.h"
 #include "non_hal_conv.h"
+#include "non_hal_disp.h"
 #include "non_hal_filter.h"
+#include "non_hal_kalmfilter.h"
+#include "non_hal_kalmbank.h"
+#include "non_hal_kalmconst.h"
+#include "non_hal_kalmmatrix.h"
+#include "non_hal_pack.h"
+#include "non_hal_prof.h"
+#include "non_hal_stream.h"
 
 /* Types ---------------------------------------------------------------------*/
 /* Variables -----------------------------------------------------------------*/
 /* Constants -----------------------------------------------------------------*/
 /* Macros --------------------------------------------------------------------*/
-
-/**@defgroup Non_HAL_Debug_Tools Non HAL tools for a debuging
-  * @brief The group debuging tools
-  * @{
-  */
-
-/** @brief Enable the data watchpoint and trace unit(DWT) and enables the CYCCNT counter
-  */
-#define ENABLE_TIC_COUNTER()  do {CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
-                                  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; \
-                                 }while(0)
-
-#define CLOCK_CYCLE_COUNTER   (DWT->CYCCNT)      /*!< The clock cycle counter in DWT */
-
-/** @brief Clear the CYCCNT register (the clock cycle counter in DWT)
-  */
-#define CLEAR_TIC_COUNTER()   (CLOCK_CYCLE_COUNTER = 0)
-
-
-
-/**
-  * @}
-  */
 /* Functions -----------------------------------------------------------------*/
 
 
@@ -0,0 +1,125 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_pack.h
+  * @brief      Header for non_hal_pack.c file.
+  *             This file defines functions to pack readings to a compact
+  *             binary form and to unpack them on a host.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_PACK_H_
+#define NON_HAL_PACK_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include <stdint.h>
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Pack_Structure Binary packing structure
+  * @brief Structure for the delta packing of a series
+  * @{
+  */
+
+/**
+  * @brief Structure with a state of the delta packing (or unpacking) of a series.
+  *        The packer and the unpacker must start from the same initial value.
+  */
+typedef struct
+{
+  int32_t last;                /*!<A previous value of the series*/
+}Non_HAL_Pack_Delta_Struct;
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A maximum number of bytes of a packed 32-bit value
+  */
+#define NON_HAL_PACK_MAX_SIZE_32BIT         5U
+
+/** @brief A maximum number of bytes of a packed 64-bit value
+  */
+#define NON_HAL_PACK_MAX_SIZE_64BIT         10U
+
+/** @brief A number of bytes which is always enough for COUNT delta packed values
+  */
+#define NON_HAL_PACK_DELTA_SIZE(COUNT)      (NON_HAL_PACK_MAX_SIZE_32BIT * (COUNT))
+
+/** @brief A number of bytes of COUNT half-float values
+  */
+#define NON_HAL_PACK_HALF_SIZE(COUNT)       (2U * (COUNT))
+
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Pack Binary packing
+  * @brief A packing of readings to varints, deltas and half-floats
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Non_HAL_Pack_UInt_32bit(uint32_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_Pack_Int_32bit(int32_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_Pack_UInt_64bit(uint64_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_Pack_Int_64bit(int64_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length);
+void Non_HAL_Pack_Delta_Init(Non_HAL_Pack_Delta_Struct *pDelta, int32_t initial);
+NON_HAL_StatusTypeDef Non_HAL_Pack_Delta(Non_HAL_Pack_Delta_Struct *pDelta, const int32_t *data, uint32_t count,
+                                         uint8_t *buf, uint32_t sizebuf, uint32_t *length, uint32_t *packed);
+uint16_t Non_HAL_Pack_Half(float data);
+NON_HAL_StatusTypeDef Non_HAL_Pack_Half_Block(const float *data, uint32_t count, uint8_t *buf, uint32_t sizebuf);
+
+/**
+  * @}
+  */
+
+/**@defgroup Non_HAL_Unpack Binary unpacking
+  * @brief An unpacking of varints, deltas and half-floats (e.g. on a host)
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Non_HAL_Unpack_UInt_32bit(const uint8_t *buf, uint32_t sizebuf, uint32_t *data_out,
+                                                uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Int_32bit(const uint8_t *buf, uint32_t sizebuf, int32_t *data_out,
+                                               uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_Unpack_UInt_64bit(const uint8_t *buf, uint32_t sizebuf, uint64_t *data_out,
+                                                uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Int_64bit(const uint8_t *buf, uint32_t sizebuf, int64_t *data_out,
+                                               uint32_t *length);
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Delta(Non_HAL_Pack_Delta_Struct *pDelta, const uint8_t *buf, uint32_t sizebuf,
+                                           int32_t *data_out, uint32_t count, uint32_t *length);
+float Non_HAL_Unpack_Half(uint16_t data);
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Half_Block(const uint8_t *buf, uint32_t sizebuf, float *data_out, uint32_t count);
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_PACK_H_ */
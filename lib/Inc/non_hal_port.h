@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_port.h
+  * @brief      This file includes the platform header of the library.
+  *             The header is given by the project with NON_HAL_PORT_HEADER
+  *             (e.g. -DNON_HAL_PORT_HEADER="stm32l4xx_hal.h"). Without it
+  *             a CubeMX project (USE_HAL_DRIVER) includes the HAL of STM32F4xx
+  *             and other targets (e.g. a host) don't need a platform header.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef NON_HAL_PORT_H_
+#define NON_HAL_PORT_H_
+
+/* Includes ------------------------------------------------------------------*/
+#if defined(NON_HAL_PORT_HEADER)
+#include NON_HAL_PORT_HEADER
+#elif defined(USE_HAL_DRIVER)
+#include "stm32f4xx_hal.h"
+#endif
+#include <stddef.h>
+#include <stdint.h>
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+
+#endif /* NON_HAL_PORT_H_ */
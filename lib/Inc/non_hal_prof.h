@@ -0,0 +1,237 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_prof.h
+  * @brief      Header for non_hal_prof.c file.
+  *             This file defines probes to measure execution time of code
+  *             on a Cortex-M core (DWT) or on a host (rdtsc, clock_gettime).
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_PROF_H_
+#define NON_HAL_PROF_H_
+
+/* Includes ------------------------------------------------------------------*/
+// the platform header brings the CMSIS header of the core (DWT, CoreDebug),
+// which must be seen before the backend is chosen, whatever the include order is
+#include "non_hal_port.h"
+#include "non_hal_def.h"
+#include <stdint.h>
+
+/* Constants -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Prof_Backends Profiling backends
+  * @brief Sources of time for the probes, NON_HAL_PROF_BACKEND selects one
+  * @{
+  */
+
+#define NON_HAL_PROF_NONE    0   /*!<Probes are compiled out*/
+#define NON_HAL_PROF_DWT     1   /*!<The DWT clock cycle counter of a Cortex-M core (cycles)*/
+#define NON_HAL_PROF_TSC     2   /*!<The time stamp counter of an x86 host (reference cycles)*/
+#define NON_HAL_PROF_POSIX   3   /*!<clock_gettime(CLOCK_MONOTONIC) of a POSIX host (nanoseconds)*/
+
+/**
+  * @}
+  */
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief The backend of the probes. It is chosen by the target if it isn't
+  *        defined by the project: the DWT unit if the CMSIS header defines it,
+  *        rdtsc on x86 hosts, clock_gettime on other POSIX hosts.
+  */
+#ifndef NON_HAL_PROF_BACKEND
+#if defined(DWT) && defined(CoreDebug)
+#define NON_HAL_PROF_BACKEND   NON_HAL_PROF_DWT
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NON_HAL_PROF_BACKEND   NON_HAL_PROF_TSC
+#elif defined(__unix__) || defined(__APPLE__)
+#define NON_HAL_PROF_BACKEND   NON_HAL_PROF_POSIX
+#else
+#define NON_HAL_PROF_BACKEND   NON_HAL_PROF_NONE
+#endif
+#endif
+
+/** @brief A name of ticks of the backend for the dump
+  */
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_DWT
+#define NON_HAL_PROF_UNIT   "cycles"
+#elif NON_HAL_PROF_BACKEND == NON_HAL_PROF_TSC
+#define NON_HAL_PROF_UNIT   "tsc"
+#elif NON_HAL_PROF_BACKEND == NON_HAL_PROF_POSIX
+#define NON_HAL_PROF_UNIT   "ns"
+#else
+#define NON_HAL_PROF_UNIT   "none"
+#endif
+
+/** @brief A number of bins of the log2 histogram of a probe. A bin k > 0
+  *        counts durations from 2^(k-1) to 2^k - 1 ticks, the last bin also
+  *        counts longer durations (33 bins cover all durations).
+  */
+#ifndef NON_HAL_PROF_HIST_BINS
+#define NON_HAL_PROF_HIST_BINS   24U
+#endif
+
+/**@defgroup Non_HAL_Debug_Tools Non HAL tools for a debuging
+  * @brief The group debuging tools
+  * @{
+  */
+
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_DWT
+/** @brief Enable the data watchpoint and trace unit(DWT) and enables the CYCCNT counter
+  */
+#define ENABLE_TIC_COUNTER()  do {CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+                                  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; \
+                                 }while(0)
+
+#define CLOCK_CYCLE_COUNTER   (DWT->CYCCNT)      /*!< The clock cycle counter in DWT */
+
+/** @brief Clear the CYCCNT register (the clock cycle counter in DWT)
+  */
+#define CLEAR_TIC_COUNTER()   (CLOCK_CYCLE_COUNTER = 0)
+#endif
+
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_NONE
+#define NON_HAL_PROF_START(PROBE)   ((void)0)                 /*!< Start a measurement of a probe */
+#define NON_HAL_PROF_STOP(PROBE)    ((void)0)                 /*!< Stop a measurement of a probe */
+#else
+#define NON_HAL_PROF_START(PROBE)   Non_HAL_Prof_Start(PROBE) /*!< Start a measurement of a probe */
+#define NON_HAL_PROF_STOP(PROBE)    Non_HAL_Prof_Stop(PROBE)  /*!< Stop a measurement of a probe */
+#endif
+
+/**
+  * @}
+  */
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Prof_Structure Profiling probe structure
+  * @brief Structure of a named probe
+  * @{
+  */
+
+/**
+  * @brief A value of the time source of the backend
+  */
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_DWT || NON_HAL_PROF_BACKEND == NON_HAL_PROF_NONE
+typedef uint32_t Non_HAL_Prof_Tick;
+#else
+typedef uint64_t Non_HAL_Prof_Tick;
+#endif
+
+/**
+  * @brief Structure with statistics of durations of one measured code block.
+  *        Durations are in ticks of the backend (see NON_HAL_PROF_UNIT).
+  */
+typedef struct
+{
+  const char *name;                         /*!<A name of the probe for the dump*/
+  uint32_t count;                           /*!<A number of measurements*/
+  uint32_t min;                             /*!<The shortest duration*/
+  uint32_t max;                             /*!<The longest duration*/
+  uint64_t sum;                             /*!<A sum of all durations*/
+  uint32_t hist[NON_HAL_PROF_HIST_BINS];    /*!<The log2 histogram of durations*/
+  Non_HAL_Prof_Tick start;                  /*!<A time of the last Non_HAL_Prof_Start*/
+}Non_HAL_Prof_Probe;
+
+/**
+  * @brief Function to write a part of the dump (e.g. to UART or to stdout)
+  */
+typedef void (*Non_HAL_Prof_Write_Callback)(void *context, const uint8_t *data, uint32_t length);
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Prof Profiling probes
+  * @brief Measuring of execution time of code with named probes
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Non_HAL_Prof_Enable(void);
+NON_HAL_StatusTypeDef Non_HAL_Prof_Init(Non_HAL_Prof_Probe *pProbe, const char *name);
+void Non_HAL_Prof_Reset(Non_HAL_Prof_Probe *pProbe);
+void Non_HAL_Prof_Add(Non_HAL_Prof_Probe *pProbe, uint32_t ticks);
+uint32_t Non_HAL_Prof_Mean(const Non_HAL_Prof_Probe *pProbe);
+NON_HAL_StatusTypeDef Non_HAL_Prof_Dump(const Non_HAL_Prof_Probe *pProbes, uint32_t count,
+                                        Non_HAL_Prof_Write_Callback write, void *context);
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_POSIX
+uint64_t Non_HAL_Prof_Posix_Now(void);
+#endif
+
+/**
+  * @brief  The function to read the time source of the backend
+  * @retval the current tick
+  */
+static inline Non_HAL_Prof_Tick Non_HAL_Prof_Now(void)
+{
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_DWT
+  return DWT->CYCCNT;
+#elif NON_HAL_PROF_BACKEND == NON_HAL_PROF_TSC
+  return __builtin_ia32_rdtsc();
+#elif NON_HAL_PROF_BACKEND == NON_HAL_PROF_POSIX
+  return Non_HAL_Prof_Posix_Now();
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief  The function to start a measurement of a probe
+  * @param  pProbe a pointer on an initialized Non_HAL_Prof_Probe structure
+  * @retval None
+  */
+static inline void Non_HAL_Prof_Start(Non_HAL_Prof_Probe *pProbe)
+{
+  pProbe->start = Non_HAL_Prof_Now();
+}
+
+/**
+  * @brief  The function to stop a measurement of a probe and to add its
+  *         duration to the statistics
+  * @note   The DWT counter wraps around in 2^32 cycles, so a measurement
+  *         must be shorter than that.
+  * @param  pProbe a pointer on a started Non_HAL_Prof_Probe structure
+  * @retval None
+  */
+static inline void Non_HAL_Prof_Stop(Non_HAL_Prof_Probe *pProbe)
+{
+  Non_HAL_Prof_Tick ticks = Non_HAL_Prof_Now() - pProbe->start;
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_TSC || NON_HAL_PROF_BACKEND == NON_HAL_PROF_POSIX
+  ticks = (ticks > UINT32_MAX) ? UINT32_MAX : ticks;
+#endif
+  Non_HAL_Prof_Add(pProbe, (uint32_t)ticks);
+}
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_PROF_H_ */
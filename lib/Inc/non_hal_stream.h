@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_stream.h
+  * @brief      Header for non_hal_stream.c file.
+  *             This file defines a stream writer which formats numbers
+  *             directly into a linear or a ring buffer (e.g. for UART DMA).
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_STREAM_H_
+#define NON_HAL_STREAM_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_def.h"
+#include <stdint.h>
+
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A size of the scratch buffer of a stream. A reserved space which
+  *        isn't contiguous in the ring buffer is formatted here and copied.
+  */
+#ifndef NON_HAL_STREAM_SCRATCH_SIZE
+#define NON_HAL_STREAM_SCRATCH_SIZE   72U
+#endif
+
+/* Types ---------------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Stream_Structure Stream writer structure
+  * @brief Structure of the stream writer
+  * @{
+  */
+
+/**
+  * @brief Buffers of the stream writer
+  */
+typedef enum
+{
+  NON_HAL_STREAM_LINEAR = 0x0U,  /*!<Data is appended to the buffer, it is reused when all data is released*/
+  NON_HAL_STREAM_RING   = 0x1U   /*!<Data wraps around the buffer (the size is a power of two)*/
+} Non_HAL_Stream_Mode;
+
+/**
+  * @brief Function to hand data of the stream to an output (e.g. to start UART DMA).
+  *        It returns a number of bytes it has already sent (e.g. length for
+  *        a blocking write, less than length for a partial write, the rest
+  *        is handed to it again) or 0 if it has taken all length bytes and
+  *        will call Non_HAL_Stream_Release later.
+  */
+typedef uint32_t (*Non_HAL_Stream_Flush_Callback)(void *context, const uint8_t *data, uint32_t length);
+
+/**
+  * @brief Structure of the stream writer. The counters are free-running:
+  *        tail <= flushed <= head, bytes from tail to flushed are in the
+  *        output, bytes from flushed to head wait for a flush.
+  */
+typedef struct
+{
+  uint8_t *buffer;                                  /*!<A buffer of the stream*/
+  uint32_t size;                                    /*!<A size of the buffer*/
+  Non_HAL_Stream_Mode mode;                         /*!<A mode of the buffer*/
+  uint32_t head;                                    /*!<A number of written bytes*/
+  uint32_t flushed;                                 /*!<A number of bytes handed to the flush callback*/
+  volatile uint32_t tail;                           /*!<A number of released bytes*/
+  uint32_t threshold;                               /*!<A number of waiting bytes which starts a flush (0 - never)*/
+  Non_HAL_Stream_Flush_Callback flush;              /*!<A flush callback (it can be NULL)*/
+  void *context;                                    /*!<A pointer which is passed to the flush callback*/
+  uint32_t dropped;                                 /*!<A number of writes which didn't fit in the buffer (each is dropped whole)*/
+  uint8_t *reserved;                                /*!<A space given by Non_HAL_Stream_Reserve*/
+  uint8_t scratch[NON_HAL_STREAM_SCRATCH_SIZE];     /*!<A space for data which isn't contiguous in the ring*/
+}Non_HAL_Stream_Struct;
+
+/**
+  * @}
+  */
+
+/* Variables -----------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**@defgroup Non_HAL_Stream Stream writer
+  * @brief Formatting of numbers directly into linear and ring buffers
+  * @{
+  */
+
+NON_HAL_StatusTypeDef Non_HAL_Stream_Init(Non_HAL_Stream_Struct *pStream, uint8_t *buffer, uint32_t size,
+                                          Non_HAL_Stream_Mode mode, uint32_t threshold,
+                                          Non_HAL_Stream_Flush_Callback flush, void *context);
+uint32_t Non_HAL_Stream_Free(const Non_HAL_Stream_Struct *pStream);
+uint8_t *Non_HAL_Stream_Reserve(Non_HAL_Stream_Struct *pStream, uint32_t maxlength);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Commit(Non_HAL_Stream_Struct *pStream, uint32_t length);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Write(Non_HAL_Stream_Struct *pStream, const uint8_t *data, uint32_t length);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_Char(Non_HAL_Stream_Struct *pStream, uint8_t symbol);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_String(Non_HAL_Stream_Struct *pStream, const char *str);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_UInt_32bit(Non_HAL_Stream_Struct *pStream, uint32_t data);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_Int_32bit(Non_HAL_Stream_Struct *pStream, int32_t data);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_Float(Non_HAL_Stream_Struct *pStream, float data);
+NON_HAL_StatusTypeDef Non_HAL_Stream_Flush(Non_HAL_Stream_Struct *pStream);
+void Non_HAL_Stream_Release(Non_HAL_Stream_Struct *pStream, uint32_t length);
+
+/**
+  * @}
+  */
+
+#endif /* NON_HAL_STREAM_H_ */
@@ -7,16 +7,49 @@
   *             This file include follow function types:
   *               - From numeric type:
   *                 + int8_t   -> string with binary symbols (0 or 1)
+  *                 + int16_t  -> string with binary symbols (0 or 1)
   *                 + int32_t  -> string with binary symbols (0 or 1)
+  *                 + int64_t  -> string with binary symbols (0 or 1)
+  *                 + uint8_t  -> string with hexadecimal symbols (0-9, A-F)
+  *                 + uint16_t -> string with hexadecimal symbols (0-9, A-F)
+  *                 + uint32_t -> string with hexadecimal symbols (0-9, A-F)
+  *                 + uint64_t -> string with hexadecimal symbols (0-9, A-F)
   *                 + uint8_t  -> string with decimal symbols (from 0 to 9)
   *                 + int8_t   -> string with decimal symbols (from 0 to 9)
   *                 + uint32_t -> string with decimal symbols (from 0 to 9)
   *                 + int32_t  -> string with decimal symbols (from 0 to 9)
+  *                 + uint64_t -> string with decimal symbols (from 0 to 9)
+  *                 + int64_t  -> string with decimal symbols (from 0 to 9)
+  *                 + uint32_t -> string with a fixed number of decimal symbols
+  *                 + int32_t  -> string with a sign and a fixed number of
+  *                               decimal symbols
   *                 + float    -> string with decimal symbols (from 0 to 9)
+  *                 + float    -> the shortest string which converts back to
+  *                               the same float value
+  *                 + float    -> string with decimal symbols with a given
+  *                               precision in fixed or scientific notation
+  *                 + double   -> the shortest string which converts back to
+  *                               the same double value
+  *                 + uint32_t array -> string with decimal symbols and separators
+  *                 + int32_t  array -> string with decimal symbols and separators
+  *                 + uint8_t  array -> string with hexadecimal symbols (a memory dump)
+  *                 + uint32_t array -> string with hexadecimal symbols (a memory dump)
   *                 .
   *               - From character string:
   *                 + string with binary symbols (0 or 1)        -> int8_t
-  *               + string with binary symbols (0 or 1)        -> int32_t
+  *                 + string with binary symbols (0 or 1)        -> int16_t
+  *                 + string with binary symbols (0 or 1)        -> int32_t
+  *                 + string with binary symbols (0 or 1)        -> int64_t
+  *                 + string with hexadecimal symbols            -> uint8_t
+  *                 + string with hexadecimal symbols            -> uint16_t
+  *                 + string with hexadecimal symbols            -> uint32_t
+  *                 + string with hexadecimal symbols            -> uint64_t
+  *                 + string with decimal symbols (from 0 to 9)  -> uint32_t
+  *                 + string with decimal symbols (from 0 to 9)  -> int32_t
+  *                 + string with decimal symbols (from 0 to 9)  -> float
+  *                 + string with decimal symbols (from 0 to 9)  -> uint64_t
+  *                 + string with decimal symbols (from 0 to 9)  -> int64_t
+  *                 + string with decimal symbols (from 0 to 9)  -> double
   *
   * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
   * @version    0.02
@@ -52,6 +85,51 @@
 #include <stdlib.h>
 
 /* Types ---------------------------------------------------------------------*/
+
+/**
+  * @brief Structure of a big unsigned integer for exact decimal comparisons
+  */
+typedef struct
+{
+  uint32_t *limb;   /*!<Limbs of the value, the least significant limb first*/
+  uint32_t size;    /*!<A number of used limbs (the top limb isn't zero)*/
+  uint32_t cap;     /*!<A number of available limbs*/
+} Non_HAL_CON_Bigint;
+
+/**
+  * @brief Structure of a floating-point value with a 64-bit significand
+  *        (value = f * 2^e)
+  */
+typedef struct
+{
+  uint64_t f;       /*!<The significand*/
+  int32_t e;        /*!<The binary exponent*/
+} Non_HAL_CON_Diyfp;
+
+/**
+  * @brief Structure of a normalized power of ten (10^k = f * 2^e)
+  */
+typedef struct
+{
+  uint64_t f;       /*!<The significand (the top bit is set)*/
+  int16_t e;        /*!<The binary exponent*/
+  int16_t k;        /*!<The decimal exponent*/
+} Non_HAL_CON_Pow10;
+
+/**
+  * @brief Structure of a decimal number read from a character string
+  */
+typedef struct
+{
+  const uint8_t *first;  /*!<A pointer on the first significant digit (NULL for 0)*/
+  uint64_t data;         /*!<The first 19 significant digits*/
+  uint32_t count;        /*!<A number of significant digits*/
+  int32_t exp10;         /*!<A decimal exponent (value = 0.ddd * 10^exp10)*/
+  bool sticky;           /*!<true if a dropped digit isn't zero*/
+  bool negative;         /*!<true for the minus sign*/
+  uint8_t special;       /*!<0 for a number, 1 for inf, 2 for nan*/
+} Non_HAL_CON_Number;
+
 /* Variables -----------------------------------------------------------------*/
 /* Constants -----------------------------------------------------------------*/
 
@@ -94,156 +172,630 @@ const uint32_t float_const_table[] =
   0x2A890926,
   0x6CE3EE76
 }; /*!< The array of values for converting a float value to a character string */
+
+static const uint64_t float_round_table[8] =
+{
+  0x0800000000000000U, 0x00CCCCCCCCCCCCCDU, 0x00147AE147AE147BU, 0x00020C49BA5E353FU,
+  0x0000346DC5D63886U, 0x0000053E2D6238DAU, 0x0000008637BD05AFU, 0x0000000D6BF94D5EU
+}; /*!< The array of halves of the n-th digit of the 4.60 fixed-point value (2^59 / 10^(n-1)) */
+
+static const uint8_t dec_pair_table[200] =
+{
+  '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+  '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+  '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+  '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+  '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+  '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+  '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+  '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+  '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+  '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+}; /*!< The array of pairs of decimal symbols from "00" to "99" */
+
+static const uint32_t dec_pow10_table[10] =
+{
+  1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+}; /*!< The array of powers of ten which fit in an uint32_t value */
+
+static const uint64_t float_pow5_inv_table[31] =
+{
+  0x0800000000000001ULL,
+  0x0666666666666667ULL,
+  0x051EB851EB851EB9ULL,
+  0x04189374BC6A7EFAULL,
+  0x068DB8BAC710CB2AULL,
+  0x053E2D6238DA3C22ULL,
+  0x0431BDE82D7B634EULL,
+  0x06B5FCA6AF2BD216ULL,
+  0x055E63B88C230E78ULL,
+  0x044B82FA09B5A52DULL,
+  0x06DF37F675EF6EAEULL,
+  0x057F5FF85E592558ULL,
+  0x0465E6604B7A8447ULL,
+  0x0709709A125DA071ULL,
+  0x05A126E1A84AE6C1ULL,
+  0x0480EBE7B9D58567ULL,
+  0x0734ACA5F6226F0BULL,
+  0x05C3BD5191B525A3ULL,
+  0x049C97747490EAE9ULL,
+  0x0760F253EDB4AB0EULL,
+  0x05E72843249088D8ULL,
+  0x04B8ED0283A6D3E0ULL,
+  0x078E480405D7B966ULL,
+  0x060B6CD004AC9452ULL,
+  0x04D5F0A66A23A9DBULL,
+  0x07BCB43D769F762BULL,
+  0x063090312BB2C4EFULL,
+  0x04F3A68DBC8F03F3ULL,
+  0x07EC3DAF94180651ULL,
+  0x065697BFA9ACD1DAULL,
+  0x051212FFBAF0A7E2ULL
+}; /*!< The array of 2^k / 5^i values for the shortest float conversion */
+
+static const uint64_t float_pow5_table[48] =
+{
+  0x1000000000000000ULL,
+  0x1400000000000000ULL,
+  0x1900000000000000ULL,
+  0x1F40000000000000ULL,
+  0x1388000000000000ULL,
+  0x186A000000000000ULL,
+  0x1E84800000000000ULL,
+  0x1312D00000000000ULL,
+  0x17D7840000000000ULL,
+  0x1DCD650000000000ULL,
+  0x12A05F2000000000ULL,
+  0x174876E800000000ULL,
+  0x1D1A94A200000000ULL,
+  0x12309CE540000000ULL,
+  0x16BCC41E90000000ULL,
+  0x1C6BF52634000000ULL,
+  0x11C37937E0800000ULL,
+  0x16345785D8A00000ULL,
+  0x1BC16D674EC80000ULL,
+  0x1158E460913D0000ULL,
+  0x15AF1D78B58C4000ULL,
+  0x1B1AE4D6E2EF5000ULL,
+  0x10F0CF064DD59200ULL,
+  0x152D02C7E14AF680ULL,
+  0x1A784379D99DB420ULL,
+  0x108B2A2C28029094ULL,
+  0x14ADF4B7320334B9ULL,
+  0x19D971E4FE8401E7ULL,
+  0x1027E72F1F128130ULL,
+  0x1431E0FAE6D7217CULL,
+  0x193E5939A08CE9DBULL,
+  0x1F8DEF8808B02452ULL,
+  0x13B8B5B5056E16B3ULL,
+  0x18A6E32246C99C60ULL,
+  0x1ED09BEAD87C0378ULL,
+  0x13426172C74D822BULL,
+  0x1812F9CF7920E2B6ULL,
+  0x1E17B84357691B64ULL,
+  0x12CED32A16A1B11EULL,
+  0x178287F49C4A1D66ULL,
+  0x1D6329F1C35CA4BFULL,
+  0x125DFA371A19E6F7ULL,
+  0x16F578C4E0A060B5ULL,
+  0x1CB2D6F618C878E3ULL,
+  0x11EFC659CF7D4B8DULL,
+  0x166BB7F0435C9E71ULL,
+  0x1C06A5EC5433C60DULL,
+  0x118427B3B4A05BC8ULL
+}; /*!< The array of 5^i / 2^k values for the shortest float conversion */
+
+static const uint32_t dec_pow5_table[14] =
+{
+  1U, 5U, 25U, 125U, 625U, 3125U, 15625U, 78125U, 390625U, 1953125U, 9765625U, 48828125U,
+  244140625U, 1220703125U
+}; /*!< The array of powers of five which fit in an uint32_t value */
+
+static const float float_pow10_table[11] =
+{
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+}; /*!< The array of powers of ten which are exact float values */
+
+static const double double_pow10_table[23] =
+{
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+}; /*!< The array of powers of ten which are exact double values */
+
+static const Non_HAL_CON_Pow10 dec_cached_pow10_table[87] =
+{
+  {0xFA8FD5A0081C0288U, -1220, -348}, {0xBAAEE17FA23EBF76U, -1193, -340}, {0x8B16FB203055AC76U, -1166, -332},
+  {0xCF42894A5DCE35EAU, -1140, -324}, {0x9A6BB0AA55653B2DU, -1113, -316}, {0xE61ACF033D1A45DFU, -1087, -308},
+  {0xAB70FE17C79AC6CAU, -1060, -300}, {0xFF77B1FCBEBCDC4FU, -1034, -292}, {0xBE5691EF416BD60CU, -1007, -284},
+  {0x8DD01FAD907FFC3CU,  -980, -276}, {0xD3515C2831559A83U,  -954, -268}, {0x9D71AC8FADA6C9B5U,  -927, -260},
+  {0xEA9C227723EE8BCBU,  -901, -252}, {0xAECC49914078536DU,  -874, -244}, {0x823C12795DB6CE57U,  -847, -236},
+  {0xC21094364DFB5637U,  -821, -228}, {0x9096EA6F3848984FU,  -794, -220}, {0xD77485CB25823AC7U,  -768, -212},
+  {0xA086CFCD97BF97F4U,  -741, -204}, {0xEF340A98172AACE5U,  -715, -196}, {0xB23867FB2A35B28EU,  -688, -188},
+  {0x84C8D4DFD2C63F3BU,  -661, -180}, {0xC5DD44271AD3CDBAU,  -635, -172}, {0x936B9FCEBB25C996U,  -608, -164},
+  {0xDBAC6C247D62A584U,  -582, -156}, {0xA3AB66580D5FDAF6U,  -555, -148}, {0xF3E2F893DEC3F126U,  -529, -140},
+  {0xB5B5ADA8AAFF80B8U,  -502, -132}, {0x87625F056C7C4A8BU,  -475, -124}, {0xC9BCFF6034C13053U,  -449, -116},
+  {0x964E858C91BA2655U,  -422, -108}, {0xDFF9772470297EBDU,  -396, -100}, {0xA6DFBD9FB8E5B88FU,  -369,  -92},
+  {0xF8A95FCF88747D94U,  -343,  -84}, {0xB94470938FA89BCFU,  -316,  -76}, {0x8A08F0F8BF0F156BU,  -289,  -68},
+  {0xCDB02555653131B6U,  -263,  -60}, {0x993FE2C6D07B7FACU,  -236,  -52}, {0xE45C10C42A2B3B06U,  -210,  -44},
+  {0xAA242499697392D3U,  -183,  -36}, {0xFD87B5F28300CA0EU,  -157,  -28}, {0xBCE5086492111AEBU,  -130,  -20},
+  {0x8CBCCC096F5088CCU,  -103,  -12}, {0xD1B71758E219652CU,   -77,   -4}, {0x9C40000000000000U,   -50,    4},
+  {0xE8D4A51000000000U,   -24,   12}, {0xAD78EBC5AC620000U,     3,   20}, {0x813F3978F8940984U,    30,   28},
+  {0xC097CE7BC90715B3U,    56,   36}, {0x8F7E32CE7BEA5C70U,    83,   44}, {0xD5D238A4ABE98068U,   109,   52},
+  {0x9F4F2726179A2245U,   136,   60}, {0xED63A231D4C4FB27U,   162,   68}, {0xB0DE65388CC8ADA8U,   189,   76},
+  {0x83C7088E1AAB65DBU,   216,   84}, {0xC45D1DF942711D9AU,   242,   92}, {0x924D692CA61BE758U,   269,  100},
+  {0xDA01EE641A708DEAU,   295,  108}, {0xA26DA3999AEF774AU,   322,  116}, {0xF209787BB47D6B85U,   348,  124},
+  {0xB454E4A179DD1877U,   375,  132}, {0x865B86925B9BC5C2U,   402,  140}, {0xC83553C5C8965D3DU,   428,  148},
+  {0x952AB45CFA97A0B3U,   455,  156}, {0xDE469FBD99A05FE3U,   481,  164}, {0xA59BC234DB398C25U,   508,  172},
+  {0xF6C69A72A3989F5CU,   534,  180}, {0xB7DCBF5354E9BECEU,   561,  188}, {0x88FCF317F22241E2U,   588,  196},
+  {0xCC20CE9BD35C78A5U,   614,  204}, {0x98165AF37B2153DFU,   641,  212}, {0xE2A0B5DC971F303AU,   667,  220},
+  {0xA8D9D1535CE3B396U,   694,  228}, {0xFB9B7CD9A4A7443CU,   720,  236}, {0xBB764C4CA7A44410U,   747,  244},
+  {0x8BAB8EEFB6409C1AU,   774,  252}, {0xD01FEF10A657842CU,   800,  260}, {0x9B10A4E5E9913129U,   827,  268},
+  {0xE7109BFBA19C0C9DU,   853,  276}, {0xAC2820D9623BF429U,   880,  284}, {0x80444B5E7AA7CF85U,   907,  292},
+  {0xBF21E44003ACDD2DU,   933,  300}, {0x8E679C2F5E44FF8FU,   960,  308}, {0xD433179D9C8CB841U,   986,  316},
+  {0x9E19DB92B4E31BA9U,  1013,  324}, {0xEB96BF6EBADF77D9U,  1039,  332}, {0xAF87023B9BF0EE6BU,  1066,  340}
+}; /*!< The array of powers of ten from 10^-348 to 10^340 with the step 8 rounded to 64 bits */
 /**
   * @}
   */
 
 /* Macros --------------------------------------------------------------------*/
+
+/** @brief The 8-digit SWAR path is used on little-endian 64-bit hosts,
+  *        32-bit cores use the digit pair table only
+  */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && (UINTPTR_MAX > 0xFFFFFFFFU)
+#define NON_HAL_CON_USE_SWAR
+#endif
+
+/** @brief A number of significant digits of a float string which are compared
+  *        exactly (a midpoint between two floats has less than 114 digits)
+  */
+#define NON_HAL_CON_FLOAT_DIGITS    128U
+
+/** @brief A number of 32-bit limbs for the exact comparison of a float string
+  *        (10^128 * 2^53 * 5^46 fits in 640 bits)
+  */
+#define NON_HAL_CON_FLOAT_LIMBS     20U
+
+/** @brief A number of significant digits of a double string which are compared
+  *        exactly (a midpoint between two doubles has less than 768 digits)
+  */
+#define NON_HAL_CON_DOUBLE_DIGITS   780U
+
+/** @brief A number of 32-bit limbs for the exact comparison of a double string
+  *        (10^780 * 2^54 * 5^1103 fits in 3072 bits)
+  */
+#define NON_HAL_CON_DOUBLE_LIMBS    96U
+
 /* Functions -----------------------------------------------------------------*/
 
 /**
-  * @brief  The function converts an int8_t value to a character string
-  *         with binary symbols (0 or 1)
-  * @param  data an int8_t value to convert to a character string
-  * @param  bitstr a pointer on a character string buffer
-  * @param  sizebuf a size of a character string which must be least 9 (+1 for \0)
-  * @retval NON_HAL_StatusTypeDef
+  * @brief  The function to count decimal digits of an uint32_t value
+  *         without a loop (log2 of the value scaled by log10(2) and corrected
+  *         with one comparison)
+  * @param  data an uint32_t value
+  * @retval a number of decimal digits (from 1 to 10)
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_8bit(int8_t data, uint8_t *bitstr, uint8_t sizebuf)
+static inline uint8_t Non_HAL_CON_Dec_Digits_32bit(uint32_t data)
 {
-  if(sizebuf > 8)
+  uint32_t digits = ((32U - (uint32_t)__builtin_clz(data | 1U)) * 1233U) >> 12;
+  return (uint8_t)(digits + ((data | 1U) >= dec_pow10_table[digits]));
+}
+
+#if defined(NON_HAL_CON_USE_SWAR)
+/**
+  * @brief  The function to convert a value less than 10^8 to eight decimal
+  *         symbols with leading zeros at once (SIMD within a register)
+  * @param  data a value less than 100000000
+  * @retval eight decimal symbols, the most significant digit in the lowest byte
+  */
+static inline uint64_t Non_HAL_CON_Swar_8Digits(uint32_t data)
+{
+  // 4 digits in each 32-bit lane, 2 digits in each 16-bit lane, 1 digit in each byte
+  uint64_t value = (data / 10000U) | ((uint64_t)(data % 10000U) << 32);
+  uint64_t quotient = ((value * 10486U) >> 20) & 0x0000007F0000007FULL;
+  value = quotient | ((value - quotient * 100U) << 16);
+  quotient = ((value * 103U) >> 10) & 0x000F000F000F000FULL;
+  value = quotient | ((value - quotient * 10U) << 8);
+  return value | 0x3030303030303030ULL;
+}
+#endif
+
+/**
+  * @brief  The function to write decimal symbols of an uint32_t value
+  *         without the null symbol
+  * @param  data an uint32_t value
+  * @param  decstr a pointer on a character string, it must have space for
+  *         digits symbols
+  * @param  digits a number of decimal digits of data
+  *         (from Non_HAL_CON_Dec_Digits_32bit)
+  * @retval None
+  */
+static inline void Non_HAL_CON_Put_Dec_32bit(uint32_t data, uint8_t *decstr, uint8_t digits)
+{
+#if defined(NON_HAL_CON_USE_SWAR)
+  // short values are faster with the pair table
+  if(digits > 4)
   {
-    bitstr += 8;
-    *bitstr-- = 0;
-    for(int i=0; i<8; i++)
+    uint64_t symbols;
+    if(digits > 8)
     {
-      *bitstr-- = ((data >> i) & 1U) + '0';
+      uint32_t high = data / 100000000U;
+      data -= high * 100000000U;
+      if(high >= 10)
+      {
+        *decstr++ = dec_pair_table[2 * high];
+      }
+      *decstr++ = dec_pair_table[2 * high + 1];
+      digits = 8;
     }
-    return NON_HAL_OK;
+    symbols = Non_HAL_CON_Swar_8Digits(data) >> (8 * (8 - digits));
+    memcpy(decstr, &symbols, digits);
+    return;
+  }
+#endif
+  decstr += digits;
+  while(data >= 100)
+  {
+    uint32_t pair = data % 100;
+    data /= 100;
+    decstr -= 2;
+    decstr[0] = dec_pair_table[2 * pair];
+    decstr[1] = dec_pair_table[2 * pair + 1];
+  }
+  if(data >= 10)
+  {
+    decstr[-2] = dec_pair_table[2 * data];
+    decstr[-1] = dec_pair_table[2 * data + 1];
   }
   else
   {
-    return NON_HAL_ERROR;
+    decstr[-1] = (uint8_t)data + '0';
   }
 }
 
 /**
-  * @brief  The function to convert an int32_t value to a character string
-  *         with binary symbols (0 or 1)
-  * @param  data an int32_t value to convert to a character string
-  * @param  bitstr a pointer on a character  string
-  * @param  sizebuf a size of character string which must be least 33 (+1 for \0)
-  * @retval NON_HAL_StatusTypeDef
+  * @brief  The function to compute the full 128-bit product of two uint64_t
+  *         values (with 32x32-bit products if the compiler has no 128-bit type)
+  * @param  a the first multiplier
+  * @param  b the second multiplier
+  * @param  low a pointer on the low 64 bits of the product
+  * @retval the high 64 bits of the product
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_32bit(int32_t data, uint8_t *bitstr, uint8_t sizebuf)
+static inline uint64_t Non_HAL_CON_Mul_64(uint64_t a, uint64_t b, uint64_t *low)
 {
-  if(sizebuf > 32)
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 product = (unsigned __int128)a * b;
+  *low = (uint64_t)product;
+  return (uint64_t)(product >> 64);
+#else
+  uint64_t ll = (uint64_t)(uint32_t)a * (uint32_t)b;
+  uint64_t lh = (uint64_t)(uint32_t)a * (uint32_t)(b >> 32);
+  uint64_t hl = (uint64_t)(uint32_t)(a >> 32) * (uint32_t)b;
+  uint64_t hh = (uint64_t)(uint32_t)(a >> 32) * (uint32_t)(b >> 32);
+  uint64_t middle = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+  *low = (middle << 32) | (uint32_t)ll;
+  return hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+#endif
+}
+
+/**
+  * @brief  The function to divide an uint64_t value by 10^8 with
+  *         a multiplication (2^90 / 10^8 rounded up, exact for all values)
+  * @param  data an uint64_t value
+  * @retval data / 100000000
+  */
+static inline uint64_t Non_HAL_CON_Div_1e8_64bit(uint64_t data)
+{
+  uint64_t low;
+  return Non_HAL_CON_Mul_64(data, 0xABCC77118461CEFDULL, &low) >> 26;
+}
+
+/**
+  * @brief  The function to write decimal symbols of a value with leading
+  *         zeros, the number of symbols doesn't depend on the value
+  * @param  data a value less than 10^digits
+  * @param  decstr a pointer on a character string, it must have space for
+  *         digits symbols
+  * @param  digits a number of symbols to write (from 1 to 8)
+  * @retval None
+  */
+static inline void Non_HAL_CON_Put_Dec_Fixed(uint32_t data, uint8_t *decstr, uint8_t digits)
+{
+#if defined(NON_HAL_CON_USE_SWAR)
+  uint64_t symbols = Non_HAL_CON_Swar_8Digits(data) >> (8 * (8 - digits));
+  memcpy(decstr, &symbols, digits);
+#else
+  // the pair loop writes from the end and stops at the last non-zero pair
+  memset(decstr, '0', digits);
+  Non_HAL_CON_Put_Dec_32bit(data, decstr, digits);
+#endif
+}
+
+/**
+  * @brief  The function to write decimal symbols of an uint64_t value
+  *         without the null symbol
+  * @note   The value is split into parts of eight digits, so a 64-bit division
+  *         (a library call on 32-bit cores) isn't used.
+  * @param  data an uint64_t value
+  * @param  decstr a pointer on a character string, it must have space for
+  *         20 symbols
+  * @retval a number of written symbols (from 1 to 20)
+  */
+static uint8_t Non_HAL_CON_Put_Dec_64bit(uint64_t data, uint8_t *decstr)
+{
+  uint8_t digits;
+  if(data <= 0xFFFFFFFFU)
   {
-    bitstr += 32;
-    *bitstr-- = 0;
-    for(int i=0; i<32; i++)
-    {
-      *bitstr-- = ((data >> i) & 1U) + '0';
-    }
-    return NON_HAL_OK;
+    digits = Non_HAL_CON_Dec_Digits_32bit((uint32_t)data);
+    Non_HAL_CON_Put_Dec_32bit((uint32_t)data, decstr, digits);
+    return digits;
+  }
+  uint64_t high = Non_HAL_CON_Div_1e8_64bit(data);
+  uint32_t low = (uint32_t)(data - high * 100000000U);
+  if(high >= 100000000U)
+  {
+    uint64_t top = Non_HAL_CON_Div_1e8_64bit(high);
+    uint32_t middle = (uint32_t)(high - top * 100000000U);
+    digits = Non_HAL_CON_Dec_Digits_32bit((uint32_t)top);
+    Non_HAL_CON_Put_Dec_32bit((uint32_t)top, decstr, digits);
+    Non_HAL_CON_Put_Dec_Fixed(middle, decstr + digits, 8);
+    digits += 8;
   }
   else
   {
-    return NON_HAL_ERROR;
+    digits = Non_HAL_CON_Dec_Digits_32bit((uint32_t)high);
+    Non_HAL_CON_Put_Dec_32bit((uint32_t)high, decstr, digits);
   }
+  Non_HAL_CON_Put_Dec_Fixed(low, decstr + digits, 8);
+  return digits + 8;
 }
 
 /**
-  * @brief  The function to convert an uint8_t value to a character string
-  *         with decimal symbols (from 0 to 9)
-  * @param  data an uint8_t value to convert to a character string
-  * @param  bitstr a pointer on a character string
-  * @param  sizebuf a size of a character string which must be least 4 (+1 for \0)
-  * @retval NON_HAL_StatusTypeDef
+  * @brief  The function to write binary symbols (0 or 1) of an uint32_t value
+  *         without the null symbol, the most significant bit first
+  * @note   Each byte (or nibble on 32-bit cores) is spread to eight (four)
+  *         symbols with one multiplication and a mask.
+  * @param  data an uint32_t value
+  * @param  bitstr a pointer on a character string, it must have space for
+  *         bits symbols
+  * @param  bits a number of the low bits of data to write (8, 16 or 32)
+  * @retval None
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_8bit(uint8_t data, uint8_t *decstr, uint8_t sizebuf)
+static inline void Non_HAL_CON_Put_Bin_32bit(uint32_t data, uint8_t *bitstr, uint8_t bits)
 {
-  if(sizebuf > 3)
+#if defined(NON_HAL_CON_USE_SWAR)
+  for(int32_t shift = bits - 8; shift >= 0; shift -= 8, bitstr += 8)
   {
-    char first_zeroflag = 1;
-    for(char i=100; i>0; i/=10)
-    {
-      *decstr = ((data/i)%10) + '0';
-      if(*decstr != 0 + '0' || first_zeroflag == 0)
-      {
-        decstr++;
-        first_zeroflag = 0;
-      }
-    }
-    *decstr = 0;
-    return NON_HAL_OK;
+    // bit i of the byte goes to bit 7 of byte 7 - i
+    uint64_t symbols = (uint64_t)((data >> shift) & 0xFFU) * 0x8040201008040201ULL;
+    symbols = ((symbols >> 7) & 0x0101010101010101ULL) | 0x3030303030303030ULL;
+    memcpy(bitstr, &symbols, sizeof(symbols));
   }
-  else
+#else
+  for(int32_t shift = bits - 4; shift >= 0; shift -= 4, bitstr += 4)
   {
-    return NON_HAL_ERROR;
+    // bit i of the nibble goes to bit 7 of byte 3 - i
+    uint32_t symbols = ((data >> shift) & 0xFU) * 0x80402010U;
+    symbols = ((symbols >> 7) & 0x01010101U) | 0x30303030U;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    symbols = __builtin_bswap32(symbols);
+#endif
+    memcpy(bitstr, &symbols, sizeof(symbols));
   }
+#endif
 }
 
 /**
-  * @brief  The function to convert an int8_t value to a character string
-  *         with decimal symbols (from 0 to 9)
-  * @param  data an int8_t value to convert to a character string
+  * @brief  The function to read a null-terminated string with binary
+  *         symbols (0 or 1), the most significant bit first
+  * @note   Eight (four on 32-bit cores) symbols are checked with one compare
+  *         and gathered to bits with one multiplication. Older bits are
+  *         shifted out of the value if the string is too long.
   * @param  bitstr a pointer on a character string
-  * @param  sizebuf a size of a character string which must be least 5 (+1 for \0)
-  * @retval NON_HAL_StatusTypeDef
+  * @param  data_out a pointer on an uint64_t output value
+  * @retval NON_HAL_ERROR if there is a non-binary symbol
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_8bit(int8_t data, uint8_t *decstr, uint8_t sizebuf)
+static NON_HAL_StatusTypeDef Non_HAL_CON_Get_Bin_64bit(const uint8_t *bitstr, uint64_t *data_out)
 {
-  if(sizebuf > 4)
+  size_t length = strlen((const char *)bitstr);
+  uint64_t data = 0;
+#if defined(NON_HAL_CON_USE_SWAR)
+  for(; length >= 8; length -= 8, bitstr += 8)
   {
-    char first_zeroflag = 1;
-    if((data & (1U << 7)) != 0)
+    uint64_t symbols;
+    memcpy(&symbols, bitstr, sizeof(symbols));
+    if((symbols & 0xFEFEFEFEFEFEFEFEULL) != 0x3030303030303030ULL)
     {
-      *decstr++ = '-';
-      data = ~data + 1;
+      return NON_HAL_ERROR;
+    }
+    // bit 0 of byte i goes to bit 63 - i
+    data = (data << 8) | (((symbols & 0x0101010101010101ULL) * 0x8040201008040201ULL) >> 56);
+  }
+#else
+  for(; length >= 4; length -= 4, bitstr += 4)
+  {
+    uint32_t symbols;
+    memcpy(&symbols, bitstr, sizeof(symbols));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    symbols = __builtin_bswap32(symbols);
+#endif
+    if((symbols & 0xFEFEFEFEU) != 0x30303030U)
+    {
+      return NON_HAL_ERROR;
+    }
+    // bit 0 of byte i goes to bit 27 - i
+    data = (data << 4) | ((((symbols & 0x01010101U) * 0x08040201U) >> 24) & 0xFU);
+  }
+#endif
+  for(; length > 0; length--, bitstr++)
+  {
+    if((*bitstr & 0xFEU) != '0')
+    {
+      return NON_HAL_ERROR;
     }
+    data = (data << 1) | (*bitstr & 1U);
+  }
+  *data_out = data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to write hexadecimal symbols (from 0 to 9 and from A
+  *         to F) of an uint32_t value with leading zeros, without the null
+  *         symbol, the most significant nibble first
+  * @note   On 64-bit cores eight nibbles are spread to eight bytes and turned
+  *         to symbols at once, 32-bit cores turn each nibble to a symbol
+  *         without a branch.
+  * @param  data an uint32_t value
+  * @param  hexstr a pointer on a character string, it must have space for
+  *         digits symbols
+  * @param  digits a number of the low nibbles of data to write (from 1 to 8)
+  * @retval None
+  */
+static inline void Non_HAL_CON_Put_Hex_32bit(uint32_t data, uint8_t *hexstr, uint8_t digits)
+{
+#if defined(NON_HAL_CON_USE_SWAR)
+  // nibble i goes to byte i, then the bytes are reversed
+  uint64_t symbols = data;
+  symbols = (symbols | (symbols << 16)) & 0x0000FFFF0000FFFFULL;
+  symbols = (symbols | (symbols << 8)) & 0x00FF00FF00FF00FFULL;
+  symbols = (symbols | (symbols << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  symbols = __builtin_bswap64(symbols);
+  // 'A' - '0' - 10 = 7 is added to the bytes from 10 to 15
+  symbols += 0x3030303030303030ULL + (((symbols + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL) * 7U;
+  symbols >>= 8 * (8 - digits);
+  memcpy(hexstr, &symbols, digits);
+#else
+  for(int32_t i = digits - 1; i >= 0; i--, data >>= 4)
+  {
+    uint32_t nibble = data & 0xFU;
+    hexstr[i] = (uint8_t)(nibble + '0' + ((nibble + 6U) >> 4) * 7U);
+  }
+#endif
+}
+
+/**
+  * @brief  The function to get a value of a hexadecimal symbol
+  * @param  symbol a symbol (from 0 to 9, from a to f or from A to F)
+  * @retval a value from 0 to 15, 16 if the symbol isn't hexadecimal
+  */
+static inline uint32_t Non_HAL_CON_Hex_Value(uint8_t symbol)
+{
+  uint32_t digit = (uint8_t)(symbol - '0');
+  uint32_t letter = (uint8_t)((symbol | 0x20U) - 'a');
+  return (digit < 10U) ? digit : ((letter < 6U) ? letter + 10U : 16U);
+}
+
+#if defined(NON_HAL_CON_USE_SWAR)
+/**
+  * @brief  The function to convert eight hexadecimal symbols to a value
+  *         at once (SIMD within a register)
+  * @note   A byte is a digit if it is from '0' to '9' or from 'a' to 'f'
+  *         in any case, the range checks don't carry between bytes.
+  * @param  symbols eight symbols, the first symbol in the lowest byte
+  * @param  data_out a pointer on the value, it is changed only for valid symbols
+  * @retval true if all symbols are hexadecimal
+  */
+static inline bool Non_HAL_CON_Swar_Parse_8Hex(uint64_t symbols, uint32_t *data_out)
+{
+  uint64_t low = symbols & 0x7F7F7F7F7F7F7F7FULL;
+  uint64_t lower = (symbols | 0x2020202020202020ULL) & 0x7F7F7F7F7F7F7F7FULL;
+  // bytes between 0x2F and 0x3A, bytes between 0x60 and 0x67 after | 0x20
+  uint64_t digit = (0xB9B9B9B9B9B9B9B9ULL - low) & ~symbols & (low + 0x5050505050505050ULL);
+  uint64_t letter = (0xE6E6E6E6E6E6E6E6ULL - lower) & ~symbols & (lower + 0x1F1F1F1F1F1F1F1FULL);
+  if(((digit | letter) & 0x8080808080808080ULL) != 0x8080808080808080ULL)
+  {
+    return false;
+  }
+  // nibble values, then the first nibble goes to the top
+  symbols = (symbols & 0x0F0F0F0F0F0F0F0FULL) + ((letter >> 7) & 0x0101010101010101ULL) * 9U;
+  symbols = __builtin_bswap64(symbols);
+  symbols = (symbols | (symbols >> 4)) & 0x00FF00FF00FF00FFULL;
+  symbols = (symbols | (symbols >> 8)) & 0x0000FFFF0000FFFFULL;
+  *data_out = (uint32_t)(symbols | (symbols >> 16));
+  return true;
+}
+#endif
+
+/**
+  * @brief  The function to read a hexadecimal number "[0x]digits" with
+  *         a given maximum number of digits
+  * @note   Leading zeros aren't counted, so "0x00FF" fits in an uint8_t value.
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  maxdigits a maximum number of significant digits (2, 4, 8 or 16)
+  * @param  data_out a pointer on an uint64_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_ERROR if there are no digits or too many digits
+  */
+static NON_HAL_StatusTypeDef Non_HAL_CON_Get_Hex(const uint8_t *hexstr, uint32_t sizebuf, uint32_t maxdigits,
+                                                 uint64_t *data_out, uint32_t *length)
+{
+  const uint8_t *begin = hexstr;
+  const uint8_t *end = hexstr + sizebuf;
+  const uint8_t *digits;
+  uint64_t data = 0;
+  uint32_t count = 0;
 
-    for(char i=100; i>0; i/=10)
+  // the prefix is skipped only before a digit, "0x" alone is read as 0
+  if(end - hexstr > 2 && hexstr[0] == '0' && (hexstr[1] | 0x20U) == 'x' && Non_HAL_CON_Hex_Value(hexstr[2]) < 16U)
+  {
+    hexstr += 2;
+  }
+  digits = hexstr;
+  while(hexstr != end && *hexstr == '0')
+  {
+    hexstr++;
+  }
+#if defined(NON_HAL_CON_USE_SWAR)
+  while(count <= 8U && end - hexstr >= 8)
+  {
+    uint64_t symbols;
+    uint32_t value;
+    memcpy(&symbols, hexstr, sizeof(symbols));
+    if(!Non_HAL_CON_Swar_Parse_8Hex(symbols, &value))
     {
-      *decstr = ((data/i)%10) + '0';
-      if(*decstr != 0 + '0' || first_zeroflag == 0)
-      {
-        decstr++;
-        first_zeroflag = 0;
-      }
+      break;
     }
-    *decstr = 0;
-    return NON_HAL_OK;
+    data = (data << 32) | value;
+    count += 8U;
+    hexstr += 8;
   }
-  else
+#endif
+  for(uint32_t value; hexstr != end && (value = Non_HAL_CON_Hex_Value(*hexstr)) < 16U; hexstr++, count++)
+  {
+    data = (data << 4) | value;
+  }
+  if(hexstr == digits)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = (uint32_t)(hexstr - begin);
+  if(count > maxdigits)
   {
+    *data_out = UINT64_MAX;
     return NON_HAL_ERROR;
   }
+  *data_out = data;
+  return NON_HAL_OK;
 }
 
 /**
-  * @brief  The function to convert an uint32_t value to a character string
-  *         with decimal symbols (from 0 to 9)
-  * @param  data an uint32_t value to convert to a character string
-  * @param  bitstr a pointer on a character string
-  * @param  sizebuf a size of a character string which must be least 11 (+1 for \0)
+  * @brief  The function converts an int8_t value to a character string
+  *         with binary symbols (0 or 1)
+  * @param  data an int8_t value to convert to a character string
+  * @param  bitstr a pointer on a character string buffer
+  * @param  sizebuf a size of a character string which must be least 9 (+1 for \0)
   * @retval NON_HAL_StatusTypeDef
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_32bit(uint32_t data, uint8_t *decstr, uint8_t sizebuf)
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_8bit(int8_t data, uint8_t *bitstr, uint8_t sizebuf)
 {
-  if(sizebuf > 10)
+  if(sizebuf > 8)
   {
-    char first_zeroflag = 1;
-    for(int32_t i=1000000000; i>0; i/=10)
-    {
-      *decstr = ((data/i)%10) + '0';
-      if(*decstr != 0 + '0' || first_zeroflag == 0)
-      {
-        decstr++;
-        first_zeroflag = 0;
-      }
-    }
-    *decstr = 0;
+    Non_HAL_CON_Put_Bin_32bit((uint8_t)data, bitstr, 8);
+    bitstr[8] = 0;
     return NON_HAL_OK;
   }
   else
@@ -253,33 +805,19 @@ NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_32bit(uint32_t data, uint8_t
 }
 
 /**
-  * @brief  The function to convert an int32_t value to a character string
-  *         with decimal symbols (from 0 to 9)
-  * @param  data an int32_t value to convert to a character string
+  * @brief  The function to convert an int16_t value to a character string
+  *         with binary symbols (0 or 1)
+  * @param  data an int16_t value to convert to a character string
   * @param  bitstr a pointer on a character string
-  * @param  sizebuf a size of a character string which must be least 12 (+1 for \0)
+  * @param  sizebuf a size of character string which must be least 17 (+1 for \0)
   * @retval NON_HAL_StatusTypeDef
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_32bit(int32_t data, uint8_t *decstr, uint8_t sizebuf)
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_16bit(int16_t data, uint8_t *bitstr, uint8_t sizebuf)
 {
-  if(sizebuf > 11)
+  if(sizebuf > 16)
   {
-    char first_zeroflag = 1;
-    if((data & (1U << 31)) != 0)
-    {
-      *decstr++ = '-';
-      data = ~data + 1;
-    }
-    for(int32_t i=1000000000; i>0; i/=10)
-    {
-      *decstr = ((data/i)%10) + '0';
-      if(*decstr != 0 + '0' || first_zeroflag == 0)
-      {
-        decstr++;
-        first_zeroflag = 0;
-      }
-    }
-    *decstr = 0;
+    Non_HAL_CON_Put_Bin_32bit((uint16_t)data, bitstr, 16);
+    bitstr[16] = 0;
     return NON_HAL_OK;
   }
   else
@@ -289,48 +827,385 @@ NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_32bit(int32_t data, uint8_t *
 }
 
 /**
-  * @brief   The function to convert a float value to a character string
-  *          with decimal symbols (from 0 to 9)
-  * @note    example: `3.40282346639e+38; 3.40282346639; 9.32998362376`.
-  * @warning The function dosen't support subnormal numbers (subnormal number = 0)
-  * @note    The function supports 0, nan, +inf, -inf also.
-  * @note    The function faster then sptrinf() about 5-10 time.
-  * @param   data a float value to convert to a character string
-  * @param   bitstr a pointer on a character string
-  * @param   sizebuf a size of a character string which must be least 14
-  * @retval  NON_HAL_StatusTypeDef
+  * @brief  The function to convert an int32_t value to a character string
+  *         with binary symbols (0 or 1)
+  * @param  data an int32_t value to convert to a character string
+  * @param  bitstr a pointer on a character  string
+  * @param  sizebuf a size of character string which must be least 33 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr, uint8_t sizebuf)
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_32bit(int32_t data, uint8_t *bitstr, uint8_t sizebuf)
 {
-  if(sizebuf < 14)
+  if(sizebuf > 32)
+  {
+    Non_HAL_CON_Put_Bin_32bit((uint32_t)data, bitstr, 32);
+    bitstr[32] = 0;
+    return NON_HAL_OK;
+  }
+  else
   {
     return NON_HAL_ERROR;
   }
-  uint8_t precision = 8;
-  uint8_t buffer[14];
-  uint8_t *pbuffer = buffer;
-  uint32_t value = *(uint32_t *)(&data);
-  uint8_t exponent = (uint8_t)(value >> 23);
-  uint32_t fraction = (value & 0x00ffffff) | 0x00800000;
+}
 
-  if(value & 0x80000000)
+/**
+  * @brief  The function to convert an int64_t value to a character string
+  *         with binary symbols (0 or 1)
+  * @param  data an int64_t value to convert to a character string
+  * @param  bitstr a pointer on a character string
+  * @param  sizebuf a size of character string which must be least 65 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_BinString_64bit(int64_t data, uint8_t *bitstr, uint8_t sizebuf)
+{
+  if(sizebuf > 64)
   {
-    *pbuffer++ = '-';
+    Non_HAL_CON_Put_Bin_32bit((uint32_t)((uint64_t)data >> 32), bitstr, 32);
+    Non_HAL_CON_Put_Bin_32bit((uint32_t)data, bitstr + 32, 32);
+    bitstr[64] = 0;
+    return NON_HAL_OK;
   }
   else
   {
-    *pbuffer++ = '+';
+    return NON_HAL_ERROR;
   }
-  // check 0, nan, +inf, -inf (subnormal number = 0).
-  if(exponent == 0 || exponent == 0xff)
-  {
+}
+
+/**
+  * @brief  The function to convert an uint8_t value to a character string
+  *         with two hexadecimal symbols (from 0 to 9 and from A to F)
+  * @note   example: `0A; FF; 00`.
+  * @param  data an uint8_t value to convert to a character string
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 3 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_8bit(uint8_t data, uint8_t *hexstr, uint8_t sizebuf)
+{
+  if(sizebuf < 3)
+  {
+    return NON_HAL_ERROR;
+  }
+  Non_HAL_CON_Put_Hex_32bit(data, hexstr, 2);
+  hexstr[2] = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an uint16_t value to a character string
+  *         with four hexadecimal symbols (from 0 to 9 and from A to F)
+  * @param  data an uint16_t value to convert to a character string
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 5 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_16bit(uint16_t data, uint8_t *hexstr, uint8_t sizebuf)
+{
+  if(sizebuf < 5)
+  {
+    return NON_HAL_ERROR;
+  }
+  Non_HAL_CON_Put_Hex_32bit(data, hexstr, 4);
+  hexstr[4] = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an uint32_t value to a character string
+  *         with eight hexadecimal symbols (from 0 to 9 and from A to F)
+  * @param  data an uint32_t value to convert to a character string
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 9 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_32bit(uint32_t data, uint8_t *hexstr, uint8_t sizebuf)
+{
+  if(sizebuf < 9)
+  {
+    return NON_HAL_ERROR;
+  }
+  Non_HAL_CON_Put_Hex_32bit(data, hexstr, 8);
+  hexstr[8] = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an uint64_t value to a character string
+  *         with sixteen hexadecimal symbols (from 0 to 9 and from A to F)
+  * @param  data an uint64_t value to convert to a character string
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 17 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_HexString_64bit(uint64_t data, uint8_t *hexstr, uint8_t sizebuf)
+{
+  if(sizebuf < 17)
+  {
+    return NON_HAL_ERROR;
+  }
+  Non_HAL_CON_Put_Hex_32bit((uint32_t)(data >> 32), hexstr, 8);
+  Non_HAL_CON_Put_Hex_32bit((uint32_t)data, hexstr + 8, 8);
+  hexstr[16] = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an uint8_t value to a character string
+  *         with decimal symbols (from 0 to 9)
+  * @param  data an uint8_t value to convert to a character string
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 4 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_8bit(uint8_t data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf > 3)
+  {
+    uint8_t digits = Non_HAL_CON_Dec_Digits_32bit(data);
+    Non_HAL_CON_Put_Dec_32bit(data, decstr, digits);
+    decstr[digits] = 0;
+    return NON_HAL_OK;
+  }
+  else
+  {
+    return NON_HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  The function to convert an int8_t value to a character string
+  *         with decimal symbols (from 0 to 9)
+  * @param  data an int8_t value to convert to a character string
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 5 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_8bit(int8_t data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf > 4)
+  {
+    // the magnitude is taken in unsigned arithmetic, so -128 is correct too
+    uint8_t magnitude = (uint8_t)data;
+    if(data < 0)
+    {
+      *decstr++ = '-';
+      magnitude = (uint8_t)(0U - magnitude);
+    }
+    return Non_HAL_CON_UInt_to_DecString_8bit(magnitude, decstr, sizebuf - 1);
+  }
+  else
+  {
+    return NON_HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  The function to convert an uint32_t value to a character string
+  *         with decimal symbols (from 0 to 9)
+  * @param  data an uint32_t value to convert to a character string
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 11 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_32bit(uint32_t data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf > 10)
+  {
+    uint8_t digits = Non_HAL_CON_Dec_Digits_32bit(data);
+    Non_HAL_CON_Put_Dec_32bit(data, decstr, digits);
+    decstr[digits] = 0;
+    return NON_HAL_OK;
+  }
+  else
+  {
+    return NON_HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  The function to convert an int32_t value to a character string
+  *         with decimal symbols (from 0 to 9)
+  * @param  data an int32_t value to convert to a character string
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 12 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_32bit(int32_t data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf > 11)
+  {
+    // the magnitude is taken in unsigned arithmetic, so INT32_MIN is correct too
+    uint32_t magnitude = (uint32_t)data;
+    if(data < 0)
+    {
+      *decstr++ = '-';
+      magnitude = 0U - magnitude;
+    }
+    return Non_HAL_CON_UInt_to_DecString_32bit(magnitude, decstr, sizebuf - 1);
+  }
+  else
+  {
+    return NON_HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  The function to convert an uint64_t value to a character string
+  *         with decimal symbols (from 0 to 9)
+  * @note   The function doesn't use a 64-bit division (see Non_HAL_CON_Put_Dec_64bit).
+  * @param  data an uint64_t value to convert to a character string
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 21 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_64bit(uint64_t data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf < 21)
+  {
+    return NON_HAL_ERROR;
+  }
+  decstr[Non_HAL_CON_Put_Dec_64bit(data, decstr)] = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an int64_t value to a character string
+  *         with decimal symbols (from 0 to 9)
+  * @param  data an int64_t value to convert to a character string
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least 21 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_64bit(int64_t data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf < 21)
+  {
+    return NON_HAL_ERROR;
+  }
+  uint64_t magnitude = (uint64_t)data;
+  if(data < 0)
+  {
+    *decstr++ = '-';
+    magnitude = 0U - magnitude;
+  }
+  decstr[Non_HAL_CON_Put_Dec_64bit(magnitude, decstr)] = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an uint32_t value to a character string
+  *         with exactly width decimal symbols (from 0 to 9), the value is
+  *         padded with leading zeros
+  * @note   example: width 5 `00042; 65535`.
+  * @note   The symbols are written at once without a check of leading zeros.
+  * @note   If the value doesn't fit in width symbols, the function doesn't
+  *         write the string and returns NON_HAL_ERROR.
+  * @param  data an uint32_t value to convert to a character string
+  * @param  width a number of symbols (from 1 to 10)
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least width + 1 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_to_DecString_Padded_32bit(uint32_t data, uint8_t width, uint8_t *decstr,
+                                                                  uint8_t sizebuf)
+{
+  if(width == 0 || width > 10 || sizebuf <= width || (width < 10 && data >= dec_pow10_table[width]))
+  {
+    return NON_HAL_ERROR;
+  }
+  decstr[width] = 0;
+  if(width > 8)
+  {
+    uint32_t high = data / 100000000U;
+    data -= high * 100000000U;
+    if(width == 10)
+    {
+      *decstr++ = dec_pair_table[2 * high];
+    }
+    *decstr++ = dec_pair_table[2 * high + 1];
+    width = 8;
+  }
+  Non_HAL_CON_Put_Dec_Fixed(data, decstr, width);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an int32_t value to a character string
+  *         with a sign and exactly width decimal symbols (from 0 to 9),
+  *         the value is padded with leading zeros
+  * @note   example: width 5 `+00042; -32768`.
+  * @note   The sign is always written, so the length is always width + 1.
+  * @note   If the value doesn't fit in width symbols, the function doesn't
+  *         write the string and returns NON_HAL_ERROR.
+  * @param  data an int32_t value to convert to a character string
+  * @param  width a number of symbols without the sign (from 1 to 10)
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of a character string which must be least width + 2 (+1 for \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_to_DecString_Padded_32bit(int32_t data, uint8_t width, uint8_t *decstr,
+                                                                 uint8_t sizebuf)
+{
+  uint32_t magnitude = (data < 0) ? 0U - (uint32_t)data : (uint32_t)data;
+  if(sizebuf < 2 || Non_HAL_CON_UInt_to_DecString_Padded_32bit(magnitude, width, decstr + 1, sizebuf - 1) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  decstr[0] = (data < 0) ? '-' : '+';
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief   The function to convert a float value to a character string
+  *          with decimal symbols (from 0 to 9)
+  * @note    example: `3.40282346639e+38; 3.40282346639; 9.32998362376`.
+  * @warning The function dosen't support subnormal numbers (subnormal number = 0)
+  * @note    The function supports 0, nan, +inf, -inf also.
+  * @note    The function faster then sptrinf() about 5-10 time.
+  * @param   data a float value to convert to a character string
+  * @param   bitstr a pointer on a character string
+  * @param   sizebuf a size of a character string, the function returns
+  *          NON_HAL_ERROR if the string doesn't fit in it (14 is enough for
+  *          most values, 19 for any value: the longest string is
+  *          `-0.000000100000008` with \0)
+  * @retval  NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr, uint8_t sizebuf)
+{
+  uint8_t precision = 8;
+  uint8_t buffer[14];
+  uint8_t *pbuffer = buffer;
+  uint32_t value;
+  memcpy(&value, &data, sizeof(value));
+  uint8_t exponent = (uint8_t)(value >> 23);
+  uint32_t fraction = (value & 0x00ffffff) | 0x00800000;
+
+  if(value & 0x80000000)
+  {
+    *pbuffer++ = '-';
+  }
+  else
+  {
+    *pbuffer++ = '+';
+  }
+  // check 0, nan, +inf, -inf (subnormal number = 0).
+  if(exponent == 0 || exponent == 0xff)
+  {
     if(exponent == 0)
     {
+      if(sizebuf < 2)
+      {
+        return NON_HAL_ERROR;
+      }
       decstr[0] = '0';
       decstr[1] = 0;
     }
     else
     {
+      if(sizebuf < ((fraction & 0x007fffff) ? 4 : 5))
+      {
+        return NON_HAL_ERROR;
+      }
       if(fraction & 0x007fffff)
       {
         decstr[0] = 'n';
@@ -340,8 +1215,8 @@ NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr
       }
       else
       {
-      decstr[0] = buffer[0];
-      decstr[1] = 'i';
+        decstr[0] = buffer[0];
+        decstr[1] = 'i';
         decstr[2] = 'n';
         decstr[3] = 'f';
         decstr[4] = 0;
@@ -355,24 +1230,23 @@ NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr
   int8_t intDigits=0, leadingZeros = 0;
   uint8_t *str_begin = &buffer[2];
   int32_t exp10 = ((((exponent>>3))*77+63)>>5) - 38;
-  uint32_t temp_value = (((uint64_t)(fraction << 8) * float_const_table[exponent / 8]) >> 32) + 1;
-  temp_value >>= 7 - (exponent & 7);
-  uint8_t digit = temp_value >> 24;
-  digit >>= 4;
+  // the whole product is kept as a 4.60 fixed-point value (a 4.28 value lost
+  // up to 7 bits of the fraction and the 8th digit was wrong)
+  uint64_t temp_value = ((uint64_t)(fraction << 8) * float_const_table[exponent / 8]) >> (7 - (exponent & 7));
+  uint8_t digit = (uint8_t)(temp_value >> 60);
   //removing leading zeros
   while(digit == 0)
   {
-    temp_value &= 0x0fffffff;
     temp_value *= 10;
-    digit = (uint8_t)(temp_value >> 28);
+    digit = (uint8_t)(temp_value >> 60);
     exp10--;
   }
   //extracting digits
   for(uint8_t i = precision+1; i > 0; i--)
   {
-    digit = (uint8_t)(temp_value >> 28);
+    digit = (uint8_t)(temp_value >> 60);
     *pbuffer++ = digit + '0';
-    temp_value &= 0x0fffffff;
+    temp_value &= 0x0FFFFFFFFFFFFFFFU;
     temp_value *= 10;
   }
   // rounding
@@ -419,6 +1293,20 @@ NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr
     exp10 = 0;
   }
   uint8_t fractDigits = digits > intDigits ? digits - intDigits : 0;
+  // the length of the string with \0 is checked before the first write
+  uint8_t length = (buffer[0] == '-') + (intDigits ? intDigits : 1) + 1;
+  if(fractDigits)
+  {
+    length += 1 + leadingZeros + fractDigits;
+  }
+  if(exp10 != 0)
+  {
+    length += abs(exp10) >= 10 ? 4 : 3;
+  }
+  if(sizebuf < length)
+  {
+    return NON_HAL_ERROR;
+  }
   if(buffer[0] == '-')
   {
     *decstr++ = '-';
@@ -466,7 +1354,9 @@ NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr
       *decstr++ = '+';
       upow10 = exp10;
     }
-    Non_HAL_CON_UInt_to_DecString_8bit(upow10, decstr, sizeof(buffer));
+    uint8_t expDigits = upow10 >= 10 ? 2 : 1;
+    Non_HAL_CON_Put_Dec_32bit(upow10, decstr, expDigits);
+    decstr[expDigits] = 0;
     return NON_HAL_OK;
   }
   *decstr = 0;
@@ -474,66 +1364,2061 @@ NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString(float data, uint8_t *decstr
 }
 
 /**
-  * @brief  The function to convert character string with binary symbols (0 or 1) to
-  *         an int8_t value
-  * @note    If the function get a string with non-binary symbols (0 or 1),
-  *         it return a NON_HAL_ERROR status
-  * @param  bitstr a pointer on a character string
-  * @param  data_out a pointer on an int8_t output value
-  * @retval NON_HAL_StatusTypeDef
+  * @brief   The function to convert a float value to a character string
+  *          with decimal symbols (from 0 to 9) with a given number of digits
+  *          after the decimal point
+  * @note    example (precision 2): `fixed: 3.14, -0.01, 1500.00;`
+  *          `scientific: 3.14e+0, -1.00e-2, 1.50e+3`.
+  * @note    The auto notation is fixed for values from 10^-precision to
+  *          10^9 and scientific otherwise.
+  * @note    Only the digits which are printed are extracted and the rounding
+  *          is made by one addition before the extraction (round half away
+  *          from zero), so there is no carry loop. Digits after the 8th
+  *          significant digit are zeros.
+  * @note    Cost: a setup of about 60 instructions (one 32x32->64 product
+  *          with float_const_table, the normalization and the size check)
+  *          and about 6 instructions per printed digit (a mask and a
+  *          multiplication by 10 of the 64-bit fixed-point value), so
+  *          precision 2 costs about 3 digits less than precision 5.
+  *          Time per call (x86-64, gcc -O2, values from 1e-3 to 1e6):
+  *          precision | fixed, ns | scientific, ns
+  *          --------- | --------- | --------------
+  *          0         | 31 - 38   | 26 - 33
+  *          2         | 39 - 48   | 31 - 39
+  *          4         | 43 - 53   | 35 - 45
+  *          8         | 48 - 58   | 41 - 50
+  *          Non_HAL_CON_Float_to_DecString() takes 82 - 97 ns and
+  *          snprintf("%.2f") takes 380 - 435 ns on the same values.
+  * @warning The function dosen't support subnormal numbers (subnormal number = 0)
+  * @note    The function supports nan, +inf, -inf also (`nan, +inf, -inf`
+  *          as Non_HAL_CON_Float_to_DecString() and the _Shortest functions).
+  * @param   data a float value to convert to a character string
+  * @param   precision a number of digits after the decimal point
+  *          (from 0 to NON_HAL_CON_FLOAT_PRECISION)
+  * @param   notation a notation of the string
+  * @param   decstr a pointer on a character string
+  * @param   sizebuf a size of a character string, the function returns
+  *          NON_HAL_ERROR if the string doesn't fit in it
+  * @retval  NON_HAL_StatusTypeDef
   */
-NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_8bit(uint8_t *bitstr, int8_t *data_out)
+NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString_Format(float data, uint8_t precision, Non_HAL_CON_Notation notation,
+                                                            uint8_t *decstr, uint8_t sizebuf)
 {
-  volatile int8_t data = 0;
-  for(;*bitstr != 0; bitstr++)
+  uint32_t value;
+  uint32_t exponent;
+  uint64_t temp_value = 0;
+  int32_t exp10 = 0;
+  int32_t ndigits;
+  uint32_t length;
+  uint32_t significant;
+  bool scientific;
+  bool negative;
+
+  if(precision > NON_HAL_CON_FLOAT_PRECISION || notation > NON_HAL_CON_AUTO)
+  {
+    return NON_HAL_ERROR;
+  }
+  memcpy(&value, &data, sizeof(value));
+  exponent = (value >> 23) & 0xFFU;
+
+  // nan, +inf, -inf
+  if(exponent == 0xFFU)
   {
-    if(*bitstr != '0' && *bitstr != '1')
+    const char *special = (value & 0x007FFFFFU) ? "nan" : ((value & 0x80000000U) ? "-inf" : "+inf");
+    length = (uint32_t)strlen(special) + 1U;
+    if(sizebuf < length)
     {
       return NON_HAL_ERROR;
     }
-    if(*bitstr == '1')
+    memcpy(decstr, special, length);
+    return NON_HAL_OK;
+  }
+
+  // the 4.60 fixed-point value from 1 to 10 and the decimal exponent (0 and subnormal numbers stay 0),
+  // the whole product is kept, so the digits are exact to about 2^-29 (the precision of float_const_table)
+  if(exponent != 0)
+  {
+    uint32_t fraction = (value & 0x007FFFFFU) | 0x00800000U;
+    exp10 = (int32_t)((((exponent >> 3) * 77U + 63U) >> 5)) - 38;
+    temp_value = ((uint64_t)(fraction << 8) * float_const_table[exponent / 8]) >> (7U - (exponent & 7U));
+    while((temp_value >> 60) == 0)
     {
-      data <<= 1;
-      data = data | 1U;
+      temp_value *= 10U;
+      exp10--;
     }
-    else
+    // the estimate may be from 10 to 16, it is divided by 10 in two 32-bit halves
+    // (the error of the low half is a few units of 2^-60)
+    if((temp_value >> 60) >= 10U)
     {
-      data <<= 1;
+      uint32_t high = (uint32_t)(temp_value >> 32);
+      temp_value = ((uint64_t)(high / 10U) << 32) + (uint64_t)(high % 10U) * 429496730U +\
+                   (uint32_t)temp_value / 10U;
+      exp10++;
     }
   }
-  *data_out = data;
-  return NON_HAL_OK;
-}
 
-/**
-  * @brief  The function to convert character string with binary symbols (0 or 1) to
-  *         an int32_t value
-  * @note    If the function get a string with non-binary symbols (0 or 1),
-  *         it return a NON_HAL_ERROR status
-  * @param  bitstr a pointer on a character string
-  * @param  data_out a pointer on an int32_t output value
+  scientific = (notation == NON_HAL_CON_SCIENTIFIC) ||
+               (notation == NON_HAL_CON_AUTO && temp_value != 0 && (exp10 < -(int32_t)precision || exp10 >= 9));
+  ndigits = scientific ? (int32_t)precision + 1 : exp10 + 1 + (int32_t)precision;
+
+  // rounding: the half of the last printed digit is added before the extraction
+  if(ndigits > 0)
+  {
+    temp_value += float_round_table[(ndigits < 8) ? ndigits - 1 : 7];
+  }
+  else if(ndigits == 0 && temp_value >= 0x5000000000000000U)
+  {
+    temp_value = 0xA000000000000000U;
+  }
+  else if(ndigits <= 0)
+  {
+    temp_value = 0;
+  }
+  if(temp_value >= 0xA000000000000000U)
+  {
+    temp_value = 0x1000000000000000U;
+    exp10++;
+    ndigits += !scientific;
+  }
+  if(temp_value == 0)
+  {
+    exp10 = 0;
+    ndigits = 0;
+  }
+  negative = (value & 0x80000000U) && temp_value != 0;
+
+  // checking the size of the string
+  length = (uint32_t)negative + (precision ? precision + 1U : 0U) + 1U;
+  if(scientific)
+  {
+    length += 1U + 2U + ((exp10 >= 10 || exp10 <= -10) ? 2U : 1U);
+  }
+  else
+  {
+    length += (exp10 >= 0) ? (uint32_t)exp10 + 1U : 1U;
+  }
+  if(sizebuf < length)
+  {
+    return NON_HAL_ERROR;
+  }
+
+  // extracting digits
+  significant = (ndigits > 8) ? 8U : (uint32_t)ndigits;
+  if(negative)
+  {
+    *decstr++ = '-';
+  }
+  if(!scientific && exp10 < 0)
+  {
+    *decstr++ = '0';
+  }
+  else if(scientific)
+  {
+    *decstr++ = (uint8_t)('0' + (significant ? (uint32_t)(temp_value >> 60) : 0U));
+    if(significant)
+    {
+      temp_value = (temp_value & 0x0FFFFFFFFFFFFFFFU) * 10U;
+      significant--;
+    }
+  }
+  else
+  {
+    for(int32_t i = exp10; i >= 0; i--)
+    {
+      *decstr++ = (uint8_t)('0' + (significant ? (uint32_t)(temp_value >> 60) : 0U));
+      if(significant)
+      {
+        temp_value = (temp_value & 0x0FFFFFFFFFFFFFFFU) * 10U;
+        significant--;
+      }
+    }
+  }
+  if(precision)
+  {
+    uint32_t zeros = (!scientific && exp10 < -1) ? (uint32_t)(-exp10 - 1) : 0U;
+    *decstr++ = '.';
+    for(uint32_t i = 0; i < precision; i++)
+    {
+      if(i < zeros || significant == 0)
+      {
+        *decstr++ = '0';
+        continue;
+      }
+      *decstr++ = (uint8_t)('0' + (uint32_t)(temp_value >> 60));
+      temp_value = (temp_value & 0x0FFFFFFFFFFFFFFFU) * 10U;
+      significant--;
+    }
+  }
+  if(scientific)
+  {
+    uint32_t upow10 = (exp10 < 0) ? (uint32_t)-exp10 : (uint32_t)exp10;
+    *decstr++ = 'e';
+    *decstr++ = (exp10 < 0) ? '-' : '+';
+    if(upow10 >= 10U)
+    {
+      *decstr++ = dec_pair_table[upow10 * 2U];
+      *decstr++ = dec_pair_table[upow10 * 2U + 1U];
+    }
+    else
+    {
+      *decstr++ = (uint8_t)('0' + upow10);
+    }
+  }
+  *decstr = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to compute ceil(log2(5^e)) (1 for e = 0)
+  * @param  e a power of five (from 0 to 3528)
+  * @retval a number of bits of 5^e
+  */
+static inline int32_t Non_HAL_CON_Pow5_Bits(int32_t e)
+{
+  return ((e * 1217359) >> 19) + 1;
+}
+
+/**
+  * @brief  The function to compute floor(log10(2^e))
+  * @param  e a power of two (from 0 to 1650)
+  * @retval floor(log10(2^e))
+  */
+static inline int32_t Non_HAL_CON_Log10_Pow2(int32_t e)
+{
+  return (e * 78913) >> 18;
+}
+
+/**
+  * @brief  The function to compute floor(log10(5^e))
+  * @param  e a power of five (from 0 to 2620)
+  * @retval floor(log10(5^e))
+  */
+static inline int32_t Non_HAL_CON_Log10_Pow5(int32_t e)
+{
+  return (e * 732923) >> 20;
+}
+
+/**
+  * @brief  The function to check if a value is divisible by 5^p
+  * @param  value a value to check
+  * @param  p a power of five
+  * @retval true if value is divisible by 5^p
+  */
+static inline bool Non_HAL_CON_Multiple_Of_Pow5(uint32_t value, int32_t p)
+{
+  int32_t count = 0;
+  while(value % 5 == 0)
+  {
+    value /= 5;
+    count++;
+  }
+  return count >= p;
+}
+
+/**
+  * @brief  The function to compute (m * factor) >> shift with 32x32-bit products
+  * @param  m a 32-bit multiplier
+  * @param  factor a 64-bit multiplier from float_pow5_table or float_pow5_inv_table
+  * @param  shift a shift (more than 32)
+  * @retval a 32-bit result
+  */
+static inline uint32_t Non_HAL_CON_Mul_Shift_32(uint32_t m, uint64_t factor, int32_t shift)
+{
+  uint64_t low = (uint64_t)m * (uint32_t)factor;
+  uint64_t high = (uint64_t)m * (uint32_t)(factor >> 32);
+  return (uint32_t)(((low >> 32) + high) >> (shift - 32));
+}
+
+/**
+  * @brief  The function to find the shortest decimal representation of
+  *         a finite non-zero float value which converts back to the same value
+  *         (the Ryu algorithm by Ulf Adams)
+  * @param  ieee_mantissa 23 bits of the mantissa of the float value
+  * @param  ieee_exponent 8 bits of the exponent of the float value
+  * @param  exp10 a pointer on the decimal exponent of the result
+  * @retval decimal digits of the result (value = digits * 10^exp10)
+  */
+static uint32_t Non_HAL_CON_Float_Shortest(uint32_t ieee_mantissa, uint32_t ieee_exponent, int32_t *exp10)
+{
+  int32_t e2;
+  uint32_t m2;
+  if(ieee_exponent == 0)
+  {
+    e2 = 1 - 127 - 23 - 2;
+    m2 = ieee_mantissa;
+  }
+  else
+  {
+    e2 = (int32_t)ieee_exponent - 127 - 23 - 2;
+    m2 = (1U << 23) | ieee_mantissa;
+  }
+  bool accept_bounds = (m2 & 1U) == 0;
+
+  // the value and its halfway points to the neighbors, multiplied by 4
+  uint32_t mv = 4 * m2;
+  uint32_t mm_shift = (ieee_mantissa != 0 || ieee_exponent <= 1);
+  uint32_t mp = 4 * m2 + 2;
+  uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+  // converting the interval to decimal
+  uint32_t vr, vp, vm;
+  int32_t e10;
+  bool vm_trailing_zeros = false;
+  bool vr_trailing_zeros = false;
+  uint8_t last_removed_digit = 0;
+  if(e2 >= 0)
+  {
+    int32_t q = Non_HAL_CON_Log10_Pow2(e2);
+    int32_t k = 59 + Non_HAL_CON_Pow5_Bits(q) - 1;
+    int32_t i = -e2 + q + k;
+    e10 = q;
+    vr = Non_HAL_CON_Mul_Shift_32(mv, float_pow5_inv_table[q], i);
+    vp = Non_HAL_CON_Mul_Shift_32(mp, float_pow5_inv_table[q], i);
+    vm = Non_HAL_CON_Mul_Shift_32(mm, float_pow5_inv_table[q], i);
+    if(q != 0 && (vp - 1) / 10 <= vm / 10)
+    {
+      int32_t l = 59 + Non_HAL_CON_Pow5_Bits(q - 1) - 1;
+      last_removed_digit = (uint8_t)(Non_HAL_CON_Mul_Shift_32(mv, float_pow5_inv_table[q - 1], -e2 + q - 1 + l) % 10);
+    }
+    if(q <= 9)
+    {
+      // only one of mp, mv and mm can be a multiple of 5
+      if(mv % 5 == 0)
+      {
+        vr_trailing_zeros = Non_HAL_CON_Multiple_Of_Pow5(mv, q);
+      }
+      else if(accept_bounds)
+      {
+        vm_trailing_zeros = Non_HAL_CON_Multiple_Of_Pow5(mm, q);
+      }
+      else
+      {
+        vp -= Non_HAL_CON_Multiple_Of_Pow5(mp, q);
+      }
+    }
+  }
+  else
+  {
+    int32_t q = Non_HAL_CON_Log10_Pow5(-e2);
+    int32_t i = -e2 - q;
+    int32_t j = q - (Non_HAL_CON_Pow5_Bits(i) - 61);
+    e10 = q + e2;
+    vr = Non_HAL_CON_Mul_Shift_32(mv, float_pow5_table[i], j);
+    vp = Non_HAL_CON_Mul_Shift_32(mp, float_pow5_table[i], j);
+    vm = Non_HAL_CON_Mul_Shift_32(mm, float_pow5_table[i], j);
+    if(q != 0 && (vp - 1) / 10 <= vm / 10)
+    {
+      j = q - 1 - (Non_HAL_CON_Pow5_Bits(i + 1) - 61);
+      last_removed_digit = (uint8_t)(Non_HAL_CON_Mul_Shift_32(mv, float_pow5_table[i + 1], j) % 10);
+    }
+    if(q <= 1)
+    {
+      // mv = 4 * m2 has at least two trailing zero bits
+      vr_trailing_zeros = true;
+      if(accept_bounds)
+      {
+        vm_trailing_zeros = (mm_shift == 1);
+      }
+      else
+      {
+        vp--;
+      }
+    }
+    else if(q < 31)
+    {
+      vr_trailing_zeros = (mv & ((1U << (q - 1)) - 1)) == 0;
+    }
+  }
+
+  // removing digits while the interval contains the shortened value
+  int32_t removed = 0;
+  uint32_t output;
+  if(vm_trailing_zeros || vr_trailing_zeros)
+  {
+    while(vp / 10 > vm / 10)
+    {
+      vm_trailing_zeros &= (vm % 10 == 0);
+      vr_trailing_zeros &= (last_removed_digit == 0);
+      last_removed_digit = (uint8_t)(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    if(vm_trailing_zeros)
+    {
+      while(vm % 10 == 0)
+      {
+        vr_trailing_zeros &= (last_removed_digit == 0);
+        last_removed_digit = (uint8_t)(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        removed++;
+      }
+    }
+    if(vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+    {
+      // rounding to even if the exact value is ...50..0
+      last_removed_digit = 4;
+    }
+    output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+  }
+  else
+  {
+    while(vp / 10 > vm / 10)
+    {
+      last_removed_digit = (uint8_t)(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    output = vr + (vr == vm || last_removed_digit >= 5);
+  }
+  *exp10 = e10 + removed;
+  return output;
+}
+
+/**
+  * @brief  The function to write decimal digits with a decimal exponent
+  *         in the fixed (e.g. 123.45, 0.00012) or the scientific notation
+  *         (e.g. 1.2345e+38), terminated by the null symbol
+  * @note   The fixed notation is used for exponents from -4 to precision-1.
+  * @param  decstr a pointer on a character string
+  * @param  digits a pointer on decimal digits (without leading zeros)
+  * @param  ndigits a number of the decimal digits
+  * @param  exp10 a decimal exponent of the first digit (value = d.ddd * 10^exp10)
+  * @param  precision a maximum number of digits of the type
+  * @retval a pointer on the null symbol at the end of the string
+  */
+static uint8_t *Non_HAL_CON_Put_Digits(uint8_t *decstr, const uint8_t *digits, uint8_t ndigits,
+                                       int32_t exp10, uint8_t precision)
+{
+  if(exp10 >= -4 && exp10 < (int32_t)precision)
+  {
+    if(exp10 < 0)
+    {
+      *decstr++ = '0';
+      *decstr++ = '.';
+      for(int32_t i = -1; i > exp10; i--)
+      {
+        *decstr++ = '0';
+      }
+      memcpy(decstr, digits, ndigits);
+      decstr += ndigits;
+    }
+    else if(ndigits <= exp10 + 1)
+    {
+      memcpy(decstr, digits, ndigits);
+      decstr += ndigits;
+      for(int32_t i = ndigits; i <= exp10; i++)
+      {
+        *decstr++ = '0';
+      }
+    }
+    else
+    {
+      memcpy(decstr, digits, exp10 + 1);
+      decstr += exp10 + 1;
+      *decstr++ = '.';
+      memcpy(decstr, digits + exp10 + 1, ndigits - exp10 - 1);
+      decstr += ndigits - exp10 - 1;
+    }
+  }
+  else
+  {
+    *decstr++ = digits[0];
+    if(ndigits > 1)
+    {
+      *decstr++ = '.';
+      memcpy(decstr, digits + 1, ndigits - 1);
+      decstr += ndigits - 1;
+    }
+    *decstr++ = 'e';
+    if(exp10 < 0)
+    {
+      *decstr++ = '-';
+      exp10 = -exp10;
+    }
+    else
+    {
+      *decstr++ = '+';
+    }
+    if(exp10 >= 100)
+    {
+      *decstr++ = (uint8_t)(exp10 / 100) + '0';
+      exp10 %= 100;
+      *decstr++ = dec_pair_table[2 * exp10];
+      *decstr++ = dec_pair_table[2 * exp10 + 1];
+    }
+    else if(exp10 >= 10)
+    {
+      *decstr++ = dec_pair_table[2 * exp10];
+      *decstr++ = dec_pair_table[2 * exp10 + 1];
+    }
+    else
+    {
+      *decstr++ = (uint8_t)exp10 + '0';
+    }
+  }
+  *decstr = 0;
+  return decstr;
+}
+
+/**
+  * @brief   The function to convert a float value to the shortest character
+  *          string with decimal symbols which converts back to the same value
+  * @note    example: `3.4028235e+38; 0.1; 100; 1e-45; 1.0000001`.
+  * @note    The fixed notation is used for decimal exponents from -4 to 8,
+  *          the scientific notation otherwise.
+  * @note    The function supports 0, -0, subnormal numbers, nan, +inf, -inf.
+  * @note    The function uses only multiplications and tables (no division
+  *          instructions), the result is always correctly rounded.
+  * @param   data a float value to convert to a character string
+  * @param   decstr a pointer on a character string
+  * @param   sizebuf a size of a character string which must be least 16
+  * @retval  NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Float_to_DecString_Shortest(float data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf < 16)
+  {
+    return NON_HAL_ERROR;
+  }
+  uint32_t value;
+  memcpy(&value, &data, sizeof(value));
+  uint32_t ieee_mantissa = value & 0x007fffff;
+  uint32_t ieee_exponent = (value >> 23) & 0xff;
+  uint8_t digits[10];
+  uint8_t ndigits;
+  int32_t exp10;
+
+  if(ieee_exponent == 0xff)
+  {
+    if(ieee_mantissa != 0)
+    {
+      memcpy(decstr, "nan", 4);
+    }
+    else
+    {
+      memcpy(decstr, (value & 0x80000000) ? "-inf" : "+inf", 5);
+    }
+    return NON_HAL_OK;
+  }
+  if(value & 0x80000000)
+  {
+    *decstr++ = '-';
+  }
+  if(ieee_exponent == 0 && ieee_mantissa == 0)
+  {
+    decstr[0] = '0';
+    decstr[1] = 0;
+    return NON_HAL_OK;
+  }
+  uint32_t output = Non_HAL_CON_Float_Shortest(ieee_mantissa, ieee_exponent, &exp10);
+  ndigits = Non_HAL_CON_Dec_Digits_32bit(output);
+  Non_HAL_CON_Put_Dec_32bit(output, digits, ndigits);
+  Non_HAL_CON_Put_Digits(decstr, digits, ndigits, exp10 + ndigits - 1, 9);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to multiply two floating-point values with 64-bit
+  *         significands (the result is rounded to 64 bits)
+  * @param  x the first multiplier
+  * @param  y the second multiplier
+  * @retval x * y
+  */
+static inline Non_HAL_CON_Diyfp Non_HAL_CON_Diyfp_Mul(Non_HAL_CON_Diyfp x, Non_HAL_CON_Diyfp y)
+{
+  uint64_t low;
+  Non_HAL_CON_Diyfp result;
+  result.f = Non_HAL_CON_Mul_64(x.f, y.f, &low);
+  result.f += low >> 63;
+  result.e = x.e + y.e + 64;
+  return result;
+}
+
+/**
+  * @brief  The function to shift a floating-point value left until the top
+  *         bit of the significand is set
+  * @param  x a floating-point value with a non-zero significand
+  * @retval the normalized value
+  */
+static inline Non_HAL_CON_Diyfp Non_HAL_CON_Diyfp_Normalize(Non_HAL_CON_Diyfp x)
+{
+  int32_t shift = __builtin_clzll(x.f);
+  x.f <<= shift;
+  x.e -= shift;
+  return x;
+}
+
+/**
+  * @brief  The function to move the last digit of Grisu2 digits closer to the
+  *         exact value while the digits stay inside the rounding interval
+  * @param  digits a pointer on the digits
+  * @param  ndigits a number of the digits
+  * @param  delta a width of the rounding interval
+  * @param  rest a distance from the digits to the upper bound
+  * @param  ten_k a weight of the last digit
+  * @param  dist a distance from the exact value to the upper bound
+  * @retval None
+  */
+static inline void Non_HAL_CON_Grisu2_Round(uint8_t *digits, uint8_t ndigits, uint64_t dist,
+                                            uint64_t delta, uint64_t rest, uint64_t ten_k)
+{
+  while(rest < dist && delta - rest >= ten_k && (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+  {
+    digits[ndigits - 1]--;
+    rest += ten_k;
+  }
+}
+
+/**
+  * @brief  The function to find a short decimal representation of a finite
+  *         positive double value which converts back to the same value
+  *         (the Grisu2 algorithm by Florian Loitsch)
+  * @note   The result is the shortest one for about 99.9% of values, other
+  *         values get one or two extra digits (at most 17 digits).
+  * @param  value a finite positive double value
+  * @param  digits a pointer on a buffer for 17 decimal symbols
+  * @param  exp10 a pointer on the decimal exponent of the result
+  * @retval a number of digits (value = digits * 10^exp10)
+  */
+static uint8_t Non_HAL_CON_Grisu2(double value, uint8_t *digits, int32_t *exp10)
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  uint64_t ieee_mantissa = bits & 0x000FFFFFFFFFFFFFULL;
+  uint32_t ieee_exponent = (uint32_t)(bits >> 52);
+  Non_HAL_CON_Diyfp v, m_minus, m_plus, w, w_minus, w_plus, c;
+
+  if(ieee_exponent == 0)
+  {
+    v.f = ieee_mantissa;
+    v.e = 1 - 1075;
+  }
+  else
+  {
+    v.f = ieee_mantissa | (1ULL << 52);
+    v.e = (int32_t)ieee_exponent - 1075;
+  }
+  // boundaries of the rounding interval, the lower one is closer for powers of two
+  m_plus.f = 2 * v.f + 1;
+  m_plus.e = v.e - 1;
+  if(ieee_mantissa == 0 && ieee_exponent > 1)
+  {
+    m_minus.f = 4 * v.f - 1;
+    m_minus.e = v.e - 2;
+  }
+  else
+  {
+    m_minus.f = 2 * v.f - 1;
+    m_minus.e = v.e - 1;
+  }
+  m_plus = Non_HAL_CON_Diyfp_Normalize(m_plus);
+  m_minus.f <<= m_minus.e - m_plus.e;
+  m_minus.e = m_plus.e;
+  v = Non_HAL_CON_Diyfp_Normalize(v);
+
+  // a cached power of ten which moves the binary exponent of w_plus to [-60, -32]
+  int32_t f = -60 - m_plus.e - 1;
+  int32_t k = (f * 78913) / (1 << 18) + (f > 0);
+  int32_t index = (348 + k + 7) / 8;
+  c.f = dec_cached_pow10_table[index].f;
+  c.e = dec_cached_pow10_table[index].e;
+
+  w = Non_HAL_CON_Diyfp_Mul(v, c);
+  w_minus = Non_HAL_CON_Diyfp_Mul(m_minus, c);
+  w_plus = Non_HAL_CON_Diyfp_Mul(m_plus, c);
+  // the products may be 1 ulp off, so the interval is made narrower
+  w_minus.f++;
+  w_plus.f--;
+
+  // digits of the integral part of w_plus, then of the fractional part
+  uint64_t delta = w_plus.f - w_minus.f;
+  uint64_t dist = w_plus.f - w.f;
+  int32_t shift = -w_plus.e;
+  uint64_t mask = (1ULL << shift) - 1;
+  uint32_t integral = (uint32_t)(w_plus.f >> shift);
+  uint64_t fraction = w_plus.f & mask;
+  uint8_t ndigits = 0;
+  int32_t n = Non_HAL_CON_Dec_Digits_32bit(integral);
+  int32_t exponent = -dec_cached_pow10_table[index].k;
+
+  while(n > 0)
+  {
+    uint32_t pow10 = dec_pow10_table[n - 1];
+    uint32_t digit = integral / pow10;
+    integral -= digit * pow10;
+    digits[ndigits++] = (uint8_t)digit + '0';
+    n--;
+    uint64_t rest = ((uint64_t)integral << shift) + fraction;
+    if(rest <= delta)
+    {
+      *exp10 = exponent + n;
+      Non_HAL_CON_Grisu2_Round(digits, ndigits, dist, delta, rest, (uint64_t)pow10 << shift);
+      return ndigits;
+    }
+  }
+  for(;;)
+  {
+    fraction *= 10;
+    delta *= 10;
+    dist *= 10;
+    digits[ndigits++] = (uint8_t)(fraction >> shift) + '0';
+    fraction &= mask;
+    n--;
+    if(fraction <= delta)
+    {
+      *exp10 = exponent + n;
+      Non_HAL_CON_Grisu2_Round(digits, ndigits, dist, delta, fraction, 1ULL << shift);
+      return ndigits;
+    }
+  }
+}
+
+/**
+  * @brief   The function to convert a double value to a short character
+  *          string with decimal symbols which converts back to the same value
+  * @note    example: `1.7976931348623157e+308; 0.1; 100; 5e-324; 1.0000000000000002`.
+  * @note    The fixed notation is used for decimal exponents from -4 to 16,
+  *          the scientific notation otherwise.
+  * @note    The function supports 0, -0, subnormal numbers, nan, +inf, -inf.
+  * @note    The function uses only integer multiplications and tables
+  *          (a cached power of ten and 64x64-bit products, no 64-bit divisions
+  *          and no floating-point instructions), so it suits Cortex-M cores
+  *          without a double FPU and hosts.
+  * @note    The function is faster than snprintf("%.17g") about 6 times and
+  *          slower than std::to_chars (Ryu) about 2 times on x86-64.
+  * @note    The function is Grisu2: the string always converts back to the
+  *          same value, but it isn't always the shortest one. Less than 0.1%
+  *          of values get one digit more than needed, for example 1e23 is
+  *          `9.999999999999999e+22` (`1e+23` is enough).
+  *          Non_HAL_CON_Float_to_DecString_Shortest() always gives the
+  *          shortest string.
+  * @param   data a double value to convert to a character string
+  * @param   decstr a pointer on a character string
+  * @param   sizebuf a size of a character string which must be least 25
+  * @retval  NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Double_to_DecString_Shortest(double data, uint8_t *decstr, uint8_t sizebuf)
+{
+  if(sizebuf < 25)
+  {
+    return NON_HAL_ERROR;
+  }
+  uint64_t value;
+  memcpy(&value, &data, sizeof(value));
+  uint8_t digits[17];
+  uint8_t ndigits;
+  int32_t exp10;
+
+  if((value & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL)
+  {
+    if((value & 0x000FFFFFFFFFFFFFULL) != 0)
+    {
+      memcpy(decstr, "nan", 4);
+    }
+    else
+    {
+      memcpy(decstr, (value & 0x8000000000000000ULL) ? "-inf" : "+inf", 5);
+    }
+    return NON_HAL_OK;
+  }
+  if(value & 0x8000000000000000ULL)
+  {
+    *decstr++ = '-';
+    value &= 0x7FFFFFFFFFFFFFFFULL;
+  }
+  if(value == 0)
+  {
+    decstr[0] = '0';
+    decstr[1] = 0;
+    return NON_HAL_OK;
+  }
+  memcpy(&data, &value, sizeof(data));
+  ndigits = Non_HAL_CON_Grisu2(data, digits, &exp10);
+  Non_HAL_CON_Put_Digits(decstr, digits, ndigits, exp10 + ndigits - 1, 17);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert an array of uint32_t values to one character
+  *         string with decimal symbols (from 0 to 9) divided by a separator
+  * @note   The string is terminated by the null symbol (it isn't counted in
+  *         length). If the buffer is too small, the function writes only the
+  *         values which fit, sets length and returns NON_HAL_ERROR.
+  * @note   A buffer of 11 * count bytes is always enough.
+  * @param  data a pointer on an array of uint32_t values
+  * @param  count a number of values in the array
+  * @param  separator a symbol between values (e.g. ',' or ' ')
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of the character string
+  * @param  length a pointer on a number of written bytes (without \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_Array_to_DecString_32bit(const uint32_t *data, uint32_t count, uint8_t separator,
+                                                                 uint8_t *decstr, uint32_t sizebuf, uint32_t *length)
+{
+  uint8_t *begin = decstr;
+  uint8_t *end = decstr + sizebuf;
+  NON_HAL_StatusTypeDef status = NON_HAL_OK;
+
+  if(sizebuf == 0)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint8_t digits = Non_HAL_CON_Dec_Digits_32bit(data[i]);
+    // digits + separator (or \0) must fit in the buffer
+    if((uint32_t)(end - decstr) < (uint32_t)digits + 1U + (i != 0))
+    {
+      status = NON_HAL_ERROR;
+      break;
+    }
+    if(i != 0)
+    {
+      *decstr++ = separator;
+    }
+    Non_HAL_CON_Put_Dec_32bit(data[i], decstr, digits);
+    decstr += digits;
+  }
+  *decstr = 0;
+  *length = (uint32_t)(decstr - begin);
+  return status;
+}
+
+/**
+  * @brief  The function to convert an array of int32_t values to one character
+  *         string with decimal symbols (from 0 to 9) divided by a separator
+  * @note   The string is terminated by the null symbol (it isn't counted in
+  *         length). If the buffer is too small, the function writes only the
+  *         values which fit, sets length and returns NON_HAL_ERROR.
+  * @note   A buffer of 12 * count bytes is always enough.
+  * @param  data a pointer on an array of int32_t values
+  * @param  count a number of values in the array
+  * @param  separator a symbol between values (e.g. ',' or ' ')
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a size of the character string
+  * @param  length a pointer on a number of written bytes (without \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_Int_Array_to_DecString_32bit(const int32_t *data, uint32_t count, uint8_t separator,
+                                                                uint8_t *decstr, uint32_t sizebuf, uint32_t *length)
+{
+  uint8_t *begin = decstr;
+  uint8_t *end = decstr + sizebuf;
+  NON_HAL_StatusTypeDef status = NON_HAL_OK;
+
+  if(sizebuf == 0)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint32_t negative = (uint32_t)data[i] >> 31;
+    uint32_t value = negative ? 0U - (uint32_t)data[i] : (uint32_t)data[i];
+    uint8_t digits = Non_HAL_CON_Dec_Digits_32bit(value);
+    // sign + digits + separator (or \0) must fit in the buffer
+    if((uint32_t)(end - decstr) < (uint32_t)digits + 1U + negative + (i != 0))
+    {
+      status = NON_HAL_ERROR;
+      break;
+    }
+    if(i != 0)
+    {
+      *decstr++ = separator;
+    }
+    *decstr = '-';
+    decstr += negative;
+    Non_HAL_CON_Put_Dec_32bit(value, decstr, digits);
+    decstr += digits;
+  }
+  *decstr = 0;
+  *length = (uint32_t)(decstr - begin);
+  return status;
+}
+
+/**
+  * @brief  The function to convert an array of bytes to one character string
+  *         with hexadecimal symbols (from 0 to 9 and from A to F) for
+  *         a memory dump
+  * @note   example: `DE AD BE EF` with separator ' ', `DEADBEEF` with 0.
+  * @note   Without a separator four bytes are converted at once. The string is
+  *         terminated by the null symbol (it isn't counted in length). If the
+  *         buffer is too small, the function writes only the bytes which fit,
+  *         sets length and returns NON_HAL_ERROR.
+  * @note   A buffer of 3 * count bytes is always enough.
+  * @param  data a pointer on an array of bytes
+  * @param  count a number of bytes in the array
+  * @param  separator a symbol between bytes (e.g. ' ' or ':'), 0 for no separator
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a size of the character string
+  * @param  length a pointer on a number of written bytes (without \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_Array_to_HexString_8bit(const uint8_t *data, uint32_t count, uint8_t separator,
+                                                                uint8_t *hexstr, uint32_t sizebuf, uint32_t *length)
+{
+  uint8_t *begin = hexstr;
+  uint8_t *end = hexstr + sizebuf;
+  NON_HAL_StatusTypeDef status = NON_HAL_OK;
+  uint32_t i = 0;
+
+  if(sizebuf == 0)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  if(separator == 0)
+  {
+    for(; count - i >= 4U && end - hexstr > 8; i += 4, hexstr += 8)
+    {
+      uint32_t word = ((uint32_t)data[i] << 24) | ((uint32_t)data[i + 1] << 16) |
+                      ((uint32_t)data[i + 2] << 8) | data[i + 3];
+      Non_HAL_CON_Put_Hex_32bit(word, hexstr, 8);
+    }
+  }
+  for(; i < count; i++)
+  {
+    // two symbols + separator (or \0) must fit in the buffer
+    if((uint32_t)(end - hexstr) < 3U + (i != 0 && separator != 0))
+    {
+      status = NON_HAL_ERROR;
+      break;
+    }
+    if(i != 0 && separator != 0)
+    {
+      *hexstr++ = separator;
+    }
+    Non_HAL_CON_Put_Hex_32bit(data[i], hexstr, 2);
+    hexstr += 2;
+  }
+  *hexstr = 0;
+  *length = (uint32_t)(hexstr - begin);
+  return status;
+}
+
+/**
+  * @brief  The function to convert an array of uint32_t values to one
+  *         character string with eight hexadecimal symbols (from 0 to 9 and
+  *         from A to F) per value for a memory dump
+  * @note   example: `20000400 08000189` with separator ' '.
+  * @note   The string is terminated by the null symbol (it isn't counted in
+  *         length). If the buffer is too small, the function writes only the
+  *         values which fit, sets length and returns NON_HAL_ERROR.
+  * @note   A buffer of 9 * count bytes is always enough.
+  * @param  data a pointer on an array of uint32_t values
+  * @param  count a number of values in the array
+  * @param  separator a symbol between values (e.g. ' ' or ','), 0 for no separator
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a size of the character string
+  * @param  length a pointer on a number of written bytes (without \0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_UInt_Array_to_HexString_32bit(const uint32_t *data, uint32_t count, uint8_t separator,
+                                                                 uint8_t *hexstr, uint32_t sizebuf, uint32_t *length)
+{
+  uint8_t *begin = hexstr;
+  uint8_t *end = hexstr + sizebuf;
+  NON_HAL_StatusTypeDef status = NON_HAL_OK;
+
+  if(sizebuf == 0)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    // eight symbols + separator (or \0) must fit in the buffer
+    if((uint32_t)(end - hexstr) < 9U + (i != 0 && separator != 0))
+    {
+      status = NON_HAL_ERROR;
+      break;
+    }
+    if(i != 0 && separator != 0)
+    {
+      *hexstr++ = separator;
+    }
+    Non_HAL_CON_Put_Hex_32bit(data[i], hexstr, 8);
+    hexstr += 8;
+  }
+  *hexstr = 0;
+  *length = (uint32_t)(hexstr - begin);
+  return status;
+}
+
+#if defined(NON_HAL_CON_USE_SWAR)
+/**
+  * @brief  The function to check that eight symbols are decimal digits
+  * @param  symbols eight symbols, the first symbol in the lowest byte
+  * @retval true if all symbols are from '0' to '9'
+  */
+static inline bool Non_HAL_CON_Swar_Is_8Digits(uint64_t symbols)
+{
+  return ((symbols & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((symbols + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+/**
+  * @brief  The function to convert eight decimal symbols to a value at once
+  *         (SIMD within a register)
+  * @param  symbols eight decimal symbols, the most significant digit in the lowest byte
+  * @retval a value less than 100000000
+  */
+static inline uint32_t Non_HAL_CON_Swar_Parse_8Digits(uint64_t symbols)
+{
+  // 2 digits in each 16-bit lane, then 4 digits in each 32-bit lane, then 8 digits
+  symbols -= 0x3030303030303030ULL;
+  symbols = (symbols * 10U) + (symbols >> 8);
+  symbols = (((symbols & 0x000000FF000000FFULL) * (100U + (1000000ULL << 32))) +
+             (((symbols >> 16) & 0x000000FF000000FFULL) * (1U + (10000ULL << 32)))) >> 32;
+  return (uint32_t)symbols;
+}
+#endif
+
+/**
+  * @brief  The function to read decimal symbols to an uint64_t value
+  * @note   Only the first 19 digits are accumulated, the next digits are
+  *         counted and checked for zero only.
+  * @param  decstr a pointer on the first symbol
+  * @param  end a pointer after the last symbol of the buffer
+  * @param  value a pointer on the accumulated value
+  * @param  digits a pointer on a number of read digits
+  * @param  sticky a pointer on a flag which is set if a dropped digit isn't zero
+  * @retval a pointer on the first symbol after the digits
+  */
+static const uint8_t *Non_HAL_CON_Read_Digits(const uint8_t *decstr, const uint8_t *end,
+                                              uint64_t *value, uint32_t *digits, bool *sticky)
+{
+  uint64_t data = *value;
+  uint32_t count = *digits;
+#if defined(NON_HAL_CON_USE_SWAR)
+  while(count <= 11U && end - decstr >= 8)
+  {
+    uint64_t symbols;
+    memcpy(&symbols, decstr, sizeof(symbols));
+    if(!Non_HAL_CON_Swar_Is_8Digits(symbols))
+    {
+      break;
+    }
+    data = data * 100000000U + Non_HAL_CON_Swar_Parse_8Digits(symbols);
+    count += 8U;
+    decstr += 8;
+  }
+#endif
+  for(; decstr != end && (uint8_t)(*decstr - '0') < 10U; decstr++, count++)
+  {
+    if(count < 19U)
+    {
+      data = data * 10U + (uint8_t)(*decstr - '0');
+    }
+    else if(*decstr != '0')
+    {
+      *sticky = true;
+    }
+  }
+  *value = data;
+  *digits = count;
+  return decstr;
+}
+
+/**
+  * @brief  The function to compare a word with symbols ignoring the case
+  * @param  decstr a pointer on the first symbol
+  * @param  end a pointer after the last symbol of the buffer
+  * @param  word a lower case word
+  * @retval a length of the word if it matches, 0 otherwise
+  */
+static uint32_t Non_HAL_CON_Match_Word(const uint8_t *decstr, const uint8_t *end, const char *word)
+{
+  uint32_t i = 0;
+  for(; word[i] != 0; i++)
+  {
+    if(decstr + i == end || (decstr[i] | 0x20U) != (uint8_t)word[i])
+    {
+      return 0;
+    }
+  }
+  return i;
+}
+
+/**
+  * @brief  The function to read a decimal number "[+|-]digits[.digits][e[+|-]digits]",
+  *         "inf", "infinity" or "nan" (the case is ignored)
+  * @param  decstr a pointer on the first symbol
+  * @param  end a pointer after the last symbol of the buffer
+  * @param  number a pointer on the read number
+  * @retval a pointer after the number, NULL if there are no digits
+  */
+static const uint8_t *Non_HAL_CON_Read_Number(const uint8_t *decstr, const uint8_t *end,
+                                              Non_HAL_CON_Number *number)
+{
+  bool found = false;
+  uint32_t word;
+
+  number->first = NULL;
+  number->data = 0;
+  number->count = 0;
+  number->exp10 = 0;
+  number->sticky = false;
+  number->negative = false;
+  number->special = 0;
+
+  if(decstr != end && (*decstr == '+' || *decstr == '-'))
+  {
+    number->negative = (*decstr == '-');
+    decstr++;
+  }
+
+  // inf, infinity, nan
+  if((word = Non_HAL_CON_Match_Word(decstr, end, "inf")) != 0)
+  {
+    word += Non_HAL_CON_Match_Word(decstr + word, end, "inity");
+    number->special = 1;
+    return decstr + word;
+  }
+  if((word = Non_HAL_CON_Match_Word(decstr, end, "nan")) != 0)
+  {
+    number->special = 2;
+    return decstr + word;
+  }
+
+  // the mantissa: value = 0.ddd * 10^exp10
+  while(decstr != end && *decstr == '0')
+  {
+    decstr++;
+    found = true;
+  }
+  if(decstr != end && (uint8_t)(*decstr - '0') < 10U)
+  {
+    number->first = decstr;
+    decstr = Non_HAL_CON_Read_Digits(decstr, end, &number->data, &number->count, &number->sticky);
+    number->exp10 = (int32_t)number->count;
+    found = true;
+  }
+  if(decstr != end && *decstr == '.')
+  {
+    const uint8_t *fraction = ++decstr;
+    if(number->count == 0)
+    {
+      while(decstr != end && *decstr == '0')
+      {
+        decstr++;
+      }
+      number->exp10 = -(int32_t)(decstr - fraction);
+      if(decstr != end && (uint8_t)(*decstr - '0') < 10U)
+      {
+        number->first = decstr;
+      }
+    }
+    decstr = Non_HAL_CON_Read_Digits(decstr, end, &number->data, &number->count, &number->sticky);
+    found |= (decstr != fraction);
+  }
+  if(!found)
+  {
+    return NULL;
+  }
+
+  // the exponent, it is read only with digits
+  if(decstr != end && (*decstr | 0x20U) == 'e')
+  {
+    const uint8_t *exponent = decstr + 1;
+    bool negative = false;
+    int32_t value = 0;
+    if(exponent != end && (*exponent == '+' || *exponent == '-'))
+    {
+      negative = (*exponent == '-');
+      exponent++;
+    }
+    if(exponent != end && (uint8_t)(*exponent - '0') < 10U)
+    {
+      for(; exponent != end && (uint8_t)(*exponent - '0') < 10U; exponent++)
+      {
+        if(value < 100000)
+        {
+          value = value * 10 + (*exponent - '0');
+        }
+      }
+      number->exp10 += negative ? -value : value;
+      decstr = exponent;
+    }
+  }
+  return decstr;
+}
+
+/**
+  * @brief  The function to compute value = value * mul + add
+  * @param  value a pointer on a big integer
+  * @param  mul a multiplier
+  * @param  add an addend
+  * @retval false if the result doesn't fit in the limbs
+  */
+static bool Non_HAL_CON_Bigint_Mul_Add(Non_HAL_CON_Bigint *value, uint32_t mul, uint32_t add)
+{
+  uint64_t carry = add;
+  for(uint32_t i = 0; i < value->size; i++)
+  {
+    carry += (uint64_t)value->limb[i] * mul;
+    value->limb[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+  if(carry != 0)
+  {
+    if(value->size == value->cap)
+    {
+      return false;
+    }
+    value->limb[value->size++] = (uint32_t)carry;
+  }
+  return true;
+}
+
+/**
+  * @brief  The function to compute value = value * 5^e
+  * @param  value a pointer on a big integer
+  * @param  e a power of five
+  * @retval false if the result doesn't fit in the limbs
+  */
+static bool Non_HAL_CON_Bigint_Mul_Pow5(Non_HAL_CON_Bigint *value, uint32_t e)
+{
+  for(; e >= 13U; e -= 13U)
+  {
+    if(!Non_HAL_CON_Bigint_Mul_Add(value, dec_pow5_table[13], 0))
+    {
+      return false;
+    }
+  }
+  return Non_HAL_CON_Bigint_Mul_Add(value, dec_pow5_table[e], 0);
+}
+
+/**
+  * @brief  The function to compute value = value << shift
+  * @param  value a pointer on a big integer
+  * @param  shift a number of bits
+  * @retval false if the result doesn't fit in the limbs
+  */
+static bool Non_HAL_CON_Bigint_Shl(Non_HAL_CON_Bigint *value, uint32_t shift)
+{
+  uint32_t words = shift >> 5;
+  uint32_t bits = shift & 31U;
+  uint32_t top;
+  uint32_t size;
+
+  if(value->size == 0)
+  {
+    return true;
+  }
+  top = bits ? value->limb[value->size - 1] >> (32U - bits) : 0;
+  size = value->size + words + (top != 0);
+  if(size > value->cap)
+  {
+    return false;
+  }
+  if(top != 0)
+  {
+    value->limb[size - 1] = top;
+  }
+  for(uint32_t i = value->size - 1; i > 0; i--)
+  {
+    value->limb[i + words] = (value->limb[i] << bits) | (bits ? value->limb[i - 1] >> (32U - bits) : 0);
+  }
+  value->limb[words] = value->limb[0] << bits;
+  memset(value->limb, 0, words * sizeof(uint32_t));
+  value->size = size;
+  return true;
+}
+
+/**
+  * @brief  The function to compare two big integers
+  * @param  a a pointer on the first big integer
+  * @param  b a pointer on the second big integer
+  * @retval -1 if a < b, 0 if a = b, 1 if a > b
+  */
+static int32_t Non_HAL_CON_Bigint_Cmp(const Non_HAL_CON_Bigint *a, const Non_HAL_CON_Bigint *b)
+{
+  if(a->size != b->size)
+  {
+    return a->size > b->size ? 1 : -1;
+  }
+  for(uint32_t i = a->size; i-- > 0;)
+  {
+    if(a->limb[i] != b->limb[i])
+    {
+      return a->limb[i] > b->limb[i] ? 1 : -1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  The function to compare a decimal string with a binary value exactly
+  * @note   Only the first maxdigits significant digits are converted to a big
+  *         integer, the next digits are checked for zero only.
+  * @param  digits a pointer on the first significant digit (a dot is skipped)
+  * @param  ndigits a number of significant digits
+  * @param  exp10 a decimal exponent of the first significant digit
+  *         (value = 0.ddd * 10^exp10)
+  * @param  mantissa a mantissa of the value to compare with
+  * @param  exp2 a binary exponent of the value (value = mantissa * 2^exp2)
+  * @param  work a pointer on 2 * cap limbs of work memory
+  * @param  cap a number of limbs of each big integer
+  * @param  maxdigits a maximum number of significant digits to convert
+  * @param  result a pointer on the result: -1 if the string is less than the value,
+  *         0 if it is equal, 1 if it is greater
+  * @retval false if the big integers don't fit in the work memory
+  */
+static bool Non_HAL_CON_Dec_Cmp(const uint8_t *digits, uint32_t ndigits, int32_t exp10, uint64_t mantissa,
+                                int32_t exp2, uint32_t *work, uint32_t cap, uint32_t maxdigits, int32_t *result)
+{
+  Non_HAL_CON_Bigint a = {work, 0, cap};
+  Non_HAL_CON_Bigint b = {work + cap, 0, cap};
+  uint32_t used = ndigits < maxdigits ? ndigits : maxdigits;
+  bool sticky = false;
+  bool ok = true;
+
+  // a = the first used digits, 9 digits per step
+  for(uint32_t i = 0; i < used;)
+  {
+    uint32_t chunk = 0;
+    uint32_t n = 0;
+    for(; n < 9U && i < used; digits++)
+    {
+      if(*digits != '.')
+      {
+        chunk = chunk * 10U + (uint8_t)(*digits - '0');
+        n++;
+        i++;
+      }
+    }
+    ok &= Non_HAL_CON_Bigint_Mul_Add(&a, dec_pow10_table[n], chunk);
+  }
+  for(uint32_t i = used; i < ndigits; digits++)
+  {
+    if(*digits != '.')
+    {
+      sticky |= (*digits != '0');
+      i++;
+    }
+  }
+  exp10 -= (int32_t)used;
+
+  b.limb[0] = (uint32_t)mantissa;
+  b.limb[1] = (uint32_t)(mantissa >> 32);
+  b.size = (b.limb[1] != 0) ? 2 : 1;
+
+  // a * 5^exp10 * 2^exp10 against b * 2^exp2
+  if(exp10 >= 0)
+  {
+    ok &= Non_HAL_CON_Bigint_Mul_Pow5(&a, (uint32_t)exp10);
+  }
+  else
+  {
+    ok &= Non_HAL_CON_Bigint_Mul_Pow5(&b, (uint32_t)-exp10);
+  }
+  if(exp10 >= exp2)
+  {
+    ok &= Non_HAL_CON_Bigint_Shl(&a, (uint32_t)(exp10 - exp2));
+  }
+  else
+  {
+    ok &= Non_HAL_CON_Bigint_Shl(&b, (uint32_t)(exp2 - exp10));
+  }
+  *result = Non_HAL_CON_Bigint_Cmp(&a, &b);
+  if(*result == 0 && sticky)
+  {
+    *result = 1;
+  }
+  return ok;
+}
+
+/**
+  * @brief  The function to get a float value from its bits as a double value
+  * @param  bits bits of a positive float value, 0x7F800000 means 2^128
+  * @retval a double value
+  */
+static inline double Non_HAL_CON_Float_Bits_Value(uint32_t bits)
+{
+  float value;
+  if(bits >= 0x7F800000U)
+  {
+    return 0x1p128;
+  }
+  memcpy(&value, &bits, sizeof(value));
+  return (double)value;
+}
+
+/**
+  * @brief  The function to convert character string with binary symbols (0 or 1) to
+  *         an int8_t value
+  * @note    If the function get a string with non-binary symbols (0 or 1),
+  *         it return a NON_HAL_ERROR status
+  * @param  bitstr a pointer on a character string
+  * @param  data_out a pointer on an int8_t output value
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_8bit(uint8_t *bitstr, int8_t *data_out)
+{
+  uint64_t data;
+  if(Non_HAL_CON_Get_Bin_64bit(bitstr, &data) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  *data_out = (int8_t)(uint8_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert character string with binary symbols (0 or 1) to
+  *         an int16_t value
+  * @note    If the function get a string with non-binary symbols (0 or 1),
+  *         it return a NON_HAL_ERROR status
+  * @param  bitstr a pointer on a character string
+  * @param  data_out a pointer on an int16_t output value
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_16bit(uint8_t *bitstr, int16_t *data_out)
+{
+  uint64_t data;
+  if(Non_HAL_CON_Get_Bin_64bit(bitstr, &data) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  *data_out = (int16_t)(uint16_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert character string with binary symbols (0 or 1) to
+  *         an int32_t value
+  * @note    If the function get a string with non-binary symbols (0 or 1),
+  *         it return a NON_HAL_ERROR status
+  * @param  bitstr a pointer on a character string
+  * @param  data_out a pointer on an int32_t output value
   * @retval NON_HAL_StatusTypeDef
   */
 NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_32bit(uint8_t *bitstr, int32_t *data_out)
 {
-  volatile int32_t data = 0;
-  for(;*bitstr != 0; bitstr++)
+  uint64_t data;
+  if(Non_HAL_CON_Get_Bin_64bit(bitstr, &data) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  *data_out = (int32_t)(uint32_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert character string with binary symbols (0 or 1) to
+  *         an int64_t value
+  * @note    If the function get a string with non-binary symbols (0 or 1),
+  *         it return a NON_HAL_ERROR status
+  * @param  bitstr a pointer on a character string
+  * @param  data_out a pointer on an int64_t output value
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_BinString_to_Int_64bit(uint8_t *bitstr, int64_t *data_out)
+{
+  uint64_t data;
+  if(Non_HAL_CON_Get_Bin_64bit(bitstr, &data) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  *data_out = (int64_t)(uint64_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert a character string with hexadecimal
+  *         symbols (from 0 to 9, from a to f, from A to F) to an uint8_t value
+  * @note   The string is "[0x]digits". The function stops at the first symbol
+  *         which isn't a part of the number (e.g. a separator or \0) or at the
+  *         end of the buffer, leading spaces aren't skipped.
+  * @note   If there are no digits, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. If the value is out of range, the function sets
+  *         data_out to UINT8_MAX and returns NON_HAL_ERROR.
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an uint8_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_8bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                         uint8_t *data_out, uint32_t *length)
+{
+  uint64_t data;
+  NON_HAL_StatusTypeDef status = Non_HAL_CON_Get_Hex(hexstr, sizebuf, 2, &data, length);
+  if(*length != 0)
+  {
+    *data_out = (uint8_t)data;
+  }
+  return status;
+}
+
+/**
+  * @brief  The function to convert a character string with hexadecimal
+  *         symbols (from 0 to 9, from a to f, from A to F) to an uint16_t value
+  * @note   The string is "[0x]digits", see Non_HAL_CON_HexString_to_UInt_8bit().
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an uint16_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_16bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                          uint16_t *data_out, uint32_t *length)
+{
+  uint64_t data;
+  NON_HAL_StatusTypeDef status = Non_HAL_CON_Get_Hex(hexstr, sizebuf, 4, &data, length);
+  if(*length != 0)
+  {
+    *data_out = (uint16_t)data;
+  }
+  return status;
+}
+
+/**
+  * @brief  The function to convert a character string with hexadecimal
+  *         symbols (from 0 to 9, from a to f, from A to F) to an uint32_t value
+  * @note   The string is "[0x]digits", see Non_HAL_CON_HexString_to_UInt_8bit().
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an uint32_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_32bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                          uint32_t *data_out, uint32_t *length)
+{
+  uint64_t data;
+  NON_HAL_StatusTypeDef status = Non_HAL_CON_Get_Hex(hexstr, sizebuf, 8, &data, length);
+  if(*length != 0)
+  {
+    *data_out = (uint32_t)data;
+  }
+  return status;
+}
+
+/**
+  * @brief  The function to convert a character string with hexadecimal
+  *         symbols (from 0 to 9, from a to f, from A to F) to an uint64_t value
+  * @note   The string is "[0x]digits", see Non_HAL_CON_HexString_to_UInt_8bit().
+  * @param  hexstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an uint64_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_HexString_to_UInt_64bit(const uint8_t *hexstr, uint32_t sizebuf,
+                                                          uint64_t *data_out, uint32_t *length)
+{
+  uint64_t data;
+  NON_HAL_StatusTypeDef status = Non_HAL_CON_Get_Hex(hexstr, sizebuf, 16, &data, length);
+  if(*length != 0)
+  {
+    *data_out = data;
+  }
+  return status;
+}
+
+/**
+  * @brief  The function to convert a character string with decimal symbols
+  *         (from 0 to 9) to an uint32_t value
+  * @note   The string is "[+]digits". The function stops at the first symbol
+  *         which isn't a part of the number (e.g. a separator or \0) or at the
+  *         end of the buffer, leading spaces aren't skipped.
+  * @note   If there are no digits, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. If the value is out of range, the function sets
+  *         data_out to UINT32_MAX and returns NON_HAL_ERROR.
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an uint32_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_UInt_32bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                          uint32_t *data_out, uint32_t *length)
+{
+  const uint8_t *begin = decstr;
+  const uint8_t *end = decstr + sizebuf;
+  const uint8_t *digits;
+  uint64_t data = 0;
+  uint32_t count = 0;
+  bool sticky = false;
+
+  if(decstr != end && *decstr == '+')
+  {
+    decstr++;
+  }
+  digits = decstr;
+  while(decstr != end && *decstr == '0')
+  {
+    decstr++;
+  }
+  decstr = Non_HAL_CON_Read_Digits(decstr, end, &data, &count, &sticky);
+  if(decstr == digits)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = (uint32_t)(decstr - begin);
+  if(count > 10U || data > UINT32_MAX)
+  {
+    *data_out = UINT32_MAX;
+    return NON_HAL_ERROR;
+  }
+  *data_out = (uint32_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert a character string with decimal symbols
+  *         (from 0 to 9) to an int32_t value
+  * @note   The string is "[+|-]digits". The function stops at the first symbol
+  *         which isn't a part of the number (e.g. a separator or \0) or at the
+  *         end of the buffer, leading spaces aren't skipped.
+  * @note   If there are no digits, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. If the value is out of range, the function sets
+  *         data_out to INT32_MIN or INT32_MAX and returns NON_HAL_ERROR.
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an int32_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Int_32bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                         int32_t *data_out, uint32_t *length)
+{
+  const uint8_t *begin = decstr;
+  const uint8_t *end = decstr + sizebuf;
+  const uint8_t *digits;
+  uint64_t data = 0;
+  uint32_t count = 0;
+  bool sticky = false;
+  bool negative = false;
+
+  if(decstr != end && (*decstr == '+' || *decstr == '-'))
+  {
+    negative = (*decstr == '-');
+    decstr++;
+  }
+  digits = decstr;
+  while(decstr != end && *decstr == '0')
+  {
+    decstr++;
+  }
+  decstr = Non_HAL_CON_Read_Digits(decstr, end, &data, &count, &sticky);
+  if(decstr == digits)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = (uint32_t)(decstr - begin);
+  if(count > 10U || data > (uint64_t)INT32_MAX + negative)
+  {
+    *data_out = negative ? INT32_MIN : INT32_MAX;
+    return NON_HAL_ERROR;
+  }
+  *data_out = negative ? (int32_t)(0U - (uint32_t)data) : (int32_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to add the 20th digit of a 64-bit value
+  * @param  data a pointer on the first 19 digits, the result is stored here
+  * @param  digit the last symbol of the value
+  * @retval false if the value is greater than UINT64_MAX
+  */
+static inline bool Non_HAL_CON_Add_20th_Digit(uint64_t *data, uint8_t digit)
+{
+  uint64_t value = (uint8_t)(digit - '0');
+  if(*data > (UINT64_MAX - value) / 10U)
+  {
+    return false;
+  }
+  *data = *data * 10U + value;
+  return true;
+}
+
+/**
+  * @brief  The function to convert a character string with decimal symbols
+  *         (from 0 to 9) to an uint64_t value
+  * @note   The string is "[+]digits". The function stops at the first symbol
+  *         which isn't a part of the number (e.g. a separator or \0) or at the
+  *         end of the buffer, leading spaces aren't skipped.
+  * @note   If there are no digits, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. If the value is out of range, the function sets
+  *         data_out to UINT64_MAX and returns NON_HAL_ERROR.
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an uint64_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_UInt_64bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                          uint64_t *data_out, uint32_t *length)
+{
+  const uint8_t *begin = decstr;
+  const uint8_t *end = decstr + sizebuf;
+  const uint8_t *digits;
+  uint64_t data = 0;
+  uint32_t count = 0;
+  bool sticky = false;
+
+  if(decstr != end && *decstr == '+')
+  {
+    decstr++;
+  }
+  digits = decstr;
+  while(decstr != end && *decstr == '0')
+  {
+    decstr++;
+  }
+  decstr = Non_HAL_CON_Read_Digits(decstr, end, &data, &count, &sticky);
+  if(decstr == digits)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = (uint32_t)(decstr - begin);
+  if(count > 20U || (count == 20U && !Non_HAL_CON_Add_20th_Digit(&data, decstr[-1])))
+  {
+    *data_out = UINT64_MAX;
+    return NON_HAL_ERROR;
+  }
+  *data_out = data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert a character string with decimal symbols
+  *         (from 0 to 9) to an int64_t value
+  * @note   The string is "[+|-]digits". The function stops at the first symbol
+  *         which isn't a part of the number (e.g. a separator or \0) or at the
+  *         end of the buffer, leading spaces aren't skipped.
+  * @note   If there are no digits, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. If the value is out of range, the function sets
+  *         data_out to INT64_MIN or INT64_MAX and returns NON_HAL_ERROR.
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on an int64_t output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Int_64bit(const uint8_t *decstr, uint32_t sizebuf,
+                                                         int64_t *data_out, uint32_t *length)
+{
+  const uint8_t *begin = decstr;
+  const uint8_t *end = decstr + sizebuf;
+  const uint8_t *digits;
+  uint64_t data = 0;
+  uint32_t count = 0;
+  bool sticky = false;
+  bool negative = false;
+
+  if(decstr != end && (*decstr == '+' || *decstr == '-'))
+  {
+    negative = (*decstr == '-');
+    decstr++;
+  }
+  digits = decstr;
+  while(decstr != end && *decstr == '0')
+  {
+    decstr++;
+  }
+  decstr = Non_HAL_CON_Read_Digits(decstr, end, &data, &count, &sticky);
+  if(decstr == digits)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = (uint32_t)(decstr - begin);
+  // 19 digits always fit in uint64_t, the 20th digit always overflows int64_t
+  if(count > 19U || data > (uint64_t)INT64_MAX + negative)
+  {
+    *data_out = negative ? INT64_MIN : INT64_MAX;
+    return NON_HAL_ERROR;
+  }
+  *data_out = negative ? (int64_t)(0U - data) : (int64_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to convert a character string with decimal symbols
+  *         (from 0 to 9) to the nearest float value
+  * @note   The string is "[+|-]digits[.digits][e[+|-]digits]", "inf",
+  *         "infinity" or "nan" (the case is ignored). The function stops at
+  *         the first symbol which isn't a part of the number (e.g. a separator
+  *         or \0) or at the end of the buffer, leading spaces aren't skipped.
+  * @note   The result is always correctly rounded (to nearest, ties to even).
+  *         Short strings are converted with one float operation, other strings
+  *         with a double estimate. Only strings which are very close to a
+  *         midpoint between two floats are compared exactly with big integers.
+  * @note   If there are no digits, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. If the value is too large, the function sets data_out
+  *         to +inf or -inf and returns NON_HAL_ERROR. Too small values are
+  *         rounded to subnormal numbers or 0.
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on a float output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Float(const uint8_t *decstr, uint32_t sizebuf,
+                                                     float *data_out, uint32_t *length)
+{
+  Non_HAL_CON_Number number;
+  const uint8_t *next = Non_HAL_CON_Read_Number(decstr, decstr + sizebuf, &number);
+  const uint8_t *first = number.first;
+  uint64_t data = number.data;
+  uint32_t count = number.count;
+  bool sticky = number.sticky;
+  int32_t exp10 = number.exp10;
+  uint32_t sign = number.negative ? 0x80000000U : 0;
+  uint32_t bits;
+
+  if(next == NULL)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = (uint32_t)(next - decstr);
+  if(number.special != 0)
+  {
+    bits = sign | ((number.special == 1) ? 0x7F800000U : 0x7FC00000U);
+    memcpy(data_out, &bits, sizeof(bits));
+    return NON_HAL_OK;
+  }
+
+  if(count == 0 || exp10 < -45)
+  {
+    // 0.ddd * 10^-46 is less than a half of the smallest subnormal number
+    bits = 0;
+  }
+  else if(exp10 > 39)
   {
-    if(*bitstr != '0' && *bitstr != '1')
+    bits = 0x7F800000U;
+  }
+  else
+  {
+    int32_t q = exp10 - (int32_t)(count < 19U ? count : 19U);
+    if(!sticky && data <= (1U << 24) && q >= -10 && q <= 10)
     {
-      return NON_HAL_ERROR;
+      // both operands are exact, so one float operation is correctly rounded
+      float value = (float)data;
+      value = (q < 0) ? value / float_pow10_table[-q] : value * float_pow10_table[q];
+      memcpy(&bits, &value, sizeof(bits));
+    }
+    else
+    {
+      // the estimate is within a few ulps of double, it is enough to round
+      // to float correctly unless it is close to a midpoint
+      double estimate = (double)data;
+      if(q >= 0)
+      {
+        for(; q > 22; q -= 22)
+        {
+          estimate *= double_pow10_table[22];
+        }
+        estimate *= double_pow10_table[q];
+      }
+      else
+      {
+        for(; q < -22; q += 22)
+        {
+          estimate /= double_pow10_table[22];
+        }
+        estimate /= double_pow10_table[-q];
+      }
+      if(estimate >= 0x1.ffffffp127)
+      {
+        bits = 0x7F800000U;
+      }
+      else
+      {
+        float value = (float)estimate;
+        memcpy(&bits, &value, sizeof(bits));
+      }
+
+      double current = Non_HAL_CON_Float_Bits_Value(bits);
+      double half = 0;
+      int32_t direction = 0;
+      if(bits < 0x7F800000U)
+      {
+        half = 0.5 * (current + Non_HAL_CON_Float_Bits_Value(bits + 1U));
+        direction = 1;
+      }
+      if(bits > 0 && (direction == 0 || estimate < current))
+      {
+        half = 0.5 * (current + Non_HAL_CON_Float_Bits_Value(bits - 1U));
+        direction = -1;
+      }
+      double distance = (estimate > half) ? estimate - half : half - estimate;
+      if(distance <= half * 0x1p-48)
+      {
+        uint32_t work[2 * NON_HAL_CON_FLOAT_LIMBS];
+        int32_t result;
+        uint64_t mantissa;
+        // half is a normal double: mantissa * 2^exp2
+        memcpy(&mantissa, &half, sizeof(mantissa));
+        int32_t exp2 = (int32_t)(mantissa >> 52) - 1075;
+        mantissa = (mantissa & 0x000FFFFFFFFFFFFFULL) | 0x0010000000000000ULL;
+        if(Non_HAL_CON_Dec_Cmp(first, count, exp10, mantissa, exp2, work, NON_HAL_CON_FLOAT_LIMBS,
+                               NON_HAL_CON_FLOAT_DIGITS, &result))
+        {
+          // the result is the even float on a tie
+          if(result == direction || (result == 0 && (bits & 1U)))
+          {
+            bits += (uint32_t)direction;
+          }
+        }
+      }
     }
-    if(*bitstr == '1')
+  }
+  bits |= sign;
+  memcpy(data_out, &bits, sizeof(bits));
+  return ((bits & 0x7FFFFFFFU) == 0x7F800000U) ? NON_HAL_ERROR : NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to round a decimal number to the nearest double value
+  * @note   The number is multiplied by a cached power of ten with 64x64-bit
+  *         products, the error of the estimate is a few units of the last of
+  *         its 64 bits. The rounding is checked with big integers only when
+  *         the estimate is that close to a midpoint between two doubles.
+  * @param  number a pointer on a decimal number with at least one digit
+  * @retval bits of the positive double value (0x7FF0000000000000 for inf)
+  */
+static uint64_t Non_HAL_CON_Double_Bits(const Non_HAL_CON_Number *number)
+{
+  uint32_t used = (number->count < 19U) ? number->count : 19U;
+  int32_t q = number->exp10 - (int32_t)used;
+  bool truncated = number->sticky || number->count > 19U;
+  uint64_t bits;
+
+  if(number->exp10 < -323)
+  {
+    // 0.ddd * 10^-324 is less than a half of the smallest subnormal number
+    return 0;
+  }
+  if(number->exp10 > 309)
+  {
+    return 0x7FF0000000000000ULL;
+  }
+  if(!truncated && number->data <= (1ULL << 53) && q >= -22 && q <= 22)
+  {
+    // both operands are exact, so one double operation is correctly rounded
+    double value = (double)number->data;
+    value = (q < 0) ? value / double_pow10_table[-q] : value * double_pow10_table[q];
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  // w = data * 10^r * 10^(8 * index - 348), r is from 0 to 7
+  Non_HAL_CON_Diyfp w = {number->data, 0};
+  int32_t index = (q + 348) >> 3;
+  int32_t r = q + 348 - 8 * index;
+  w = Non_HAL_CON_Diyfp_Normalize(w);
+  if(r != 0)
+  {
+    Non_HAL_CON_Diyfp p = {dec_pow10_table[r], 0};
+    w = Non_HAL_CON_Diyfp_Normalize(Non_HAL_CON_Diyfp_Mul(w, Non_HAL_CON_Diyfp_Normalize(p)));
+  }
+  Non_HAL_CON_Diyfp c = {dec_cached_pow10_table[index].f, dec_cached_pow10_table[index].e};
+  w = Non_HAL_CON_Diyfp_Normalize(Non_HAL_CON_Diyfp_Mul(w, c));
+
+  // the estimate is within 8 units of its last bit, dropped digits add
+  // up to 2^64 / 10^18 units before the two products
+  uint64_t error = truncated ? 96U : 8U;
+  int32_t msb = w.e + 63;
+  if(msb > 1023)
+  {
+    return 0x7FF0000000000000ULL;
+  }
+  int32_t drop = (msb < -1022) ? 11 - 1022 - msb : 11;
+  if(drop > 64)
+  {
+    return 0;
+  }
+  uint64_t mantissa = (drop < 64) ? w.f >> drop : 0;
+  uint64_t rest = (drop < 64) ? w.f & ((1ULL << drop) - 1U) : w.f;
+  uint64_t half = 1ULL << (drop - 1);
+  bits = (msb < -1022) ? mantissa : ((uint64_t)(msb + 1022) << 52) + mantissa;
+
+  uint64_t distance = (rest > half) ? rest - half : half - rest;
+  if(distance > error)
+  {
+    bits += (rest > half);
+  }
+  else
+  {
+    uint32_t work[2 * NON_HAL_CON_DOUBLE_LIMBS];
+    int32_t result;
+    if(Non_HAL_CON_Dec_Cmp(number->first, number->count, number->exp10, 2 * mantissa + 1, w.e + drop - 1,
+                           work, NON_HAL_CON_DOUBLE_LIMBS, NON_HAL_CON_DOUBLE_DIGITS, &result))
     {
-      data <<= 1;
-      data = data | 1U;
+      // the result is the even double on a tie
+      bits += (result > 0 || (result == 0 && (bits & 1U)));
     }
     else
     {
-      data <<= 1;
+      bits += (rest > half);
     }
   }
-  *data_out = data;
-  return NON_HAL_OK;
+  return (bits > 0x7FF0000000000000ULL) ? 0x7FF0000000000000ULL : bits;
 }
 
+/**
+  * @brief  The function to convert a character string with decimal symbols
+  *         (from 0 to 9) to the nearest double value
+  * @note   The string is "[+|-]digits[.digits][e[+|-]digits]", "inf",
+  *         "infinity" or "nan" (the case is ignored). The function stops at
+  *         the first symbol which isn't a part of the number (e.g. a separator
+  *         or \0) or at the end of the buffer, leading spaces aren't skipped.
+  * @note   The result is always correctly rounded (to nearest, ties to even).
+  *         Short strings are converted with one double operation, other
+  *         strings with 64-bit products and a cached power of ten. Only
+  *         strings which are very close to a midpoint between two doubles are
+  *         compared exactly with big integers (768 bytes of the stack).
+  * @note   The function is faster than strtod() about 6 times on x86-64.
+  * @note   If there are no digits, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. If the value is too large, the function sets data_out
+  *         to +inf or -inf and returns NON_HAL_ERROR. Too small values are
+  *         rounded to subnormal numbers or 0.
+  * @param  decstr a pointer on a character string
+  * @param  sizebuf a maximum number of symbols to read
+  * @param  data_out a pointer on a double output value
+  * @param  length a pointer on a number of read symbols
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_CON_DecString_to_Double(const uint8_t *decstr, uint32_t sizebuf,
+                                                      double *data_out, uint32_t *length)
+{
+  Non_HAL_CON_Number number;
+  const uint8_t *next = Non_HAL_CON_Read_Number(decstr, decstr + sizebuf, &number);
+  uint64_t sign;
+  uint64_t bits;
+
+  if(next == NULL)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = (uint32_t)(next - decstr);
+  sign = number.negative ? 0x8000000000000000ULL : 0;
+  if(number.special != 0)
+  {
+    bits = sign | ((number.special == 1) ? 0x7FF0000000000000ULL : 0x7FF8000000000000ULL);
+    memcpy(data_out, &bits, sizeof(bits));
+    return NON_HAL_OK;
+  }
+  bits = (number.count == 0) ? 0 : Non_HAL_CON_Double_Bits(&number);
+  bits |= sign;
+  memcpy(data_out, &bits, sizeof(bits));
+  return ((bits & 0x7FFFFFFFFFFFFFFFULL) == 0x7FF0000000000000ULL) ? NON_HAL_ERROR : NON_HAL_OK;
+}
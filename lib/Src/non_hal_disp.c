@@ -0,0 +1,305 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_disp.c
+  * @brief      This file provides functions to update numeric fields of
+  *             a display incrementally. A field keeps the symbols which are
+  *             on the display, a new value changes only the symbols which
+  *             differ and the display driver redraws only this span.
+  * @note       example (width 6, 1 decimal): 123.4 -> 123.5 redraws one symbol,
+  *             99.9 -> 100.0 redraws "100.0", 5.0 -> -5.0 redraws "-".
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_lib.h"
+#include <string.h>
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+
+static const float disp_pow10_table[NON_HAL_DISP_MAX_DECIMALS + 1] =
+{
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f
+}; /*!< The array of scales of float values for digits after the point */
+
+/* Macros --------------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function to add a span of changed symbols to the dirty span
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @param  first the first changed symbol
+  * @param  end a symbol after the last changed symbol
+  * @retval None
+  */
+static inline void Non_HAL_Disp_Mark(Non_HAL_Disp_Field_Struct *pField, uint8_t first, uint8_t end)
+{
+  if(pField->first == pField->end)
+  {
+    pField->first = first;
+    pField->end = end;
+    return;
+  }
+  if(first < pField->first)
+  {
+    pField->first = first;
+  }
+  if(end > pField->end)
+  {
+    pField->end = end;
+  }
+}
+
+/**
+  * @brief  The function to write all symbols of a number right aligned
+  * @note   If the number doesn't fit in the field, the field is filled with '#'.
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @param  magnitude an absolute value of the number
+  * @param  negative true if the number is negative
+  * @param  text a pointer on width symbols
+  * @retval NON_HAL_ERROR if the number doesn't fit in the field
+  */
+static NON_HAL_StatusTypeDef Non_HAL_Disp_Format(const Non_HAL_Disp_Field_Struct *pField, uint32_t magnitude,
+                                                 bool negative, uint8_t *text)
+{
+  int32_t i = pField->width;
+  uint32_t digits = 0;
+
+  // digits after the point, the point, then at least one digit before it
+  do
+  {
+    if(i == 0)
+    {
+      break;
+    }
+    if(digits == pField->decimals && digits != 0)
+    {
+      text[--i] = '.';
+      if(i == 0)
+      {
+        break;
+      }
+    }
+    text[--i] = (uint8_t)(magnitude % 10U) + '0';
+    magnitude /= 10U;
+    digits++;
+  } while(magnitude != 0 || digits <= pField->decimals);
+
+  if(magnitude != 0 || digits <= pField->decimals || (negative && i == 0))
+  {
+    memset(text, '#', pField->width);
+    return NON_HAL_ERROR;
+  }
+  if(negative)
+  {
+    text[--i] = '-';
+  }
+  memset(text, ' ', (size_t)i);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to show a number in the field
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @param  magnitude an absolute value of the number
+  * @param  negative true if the number is negative (magnitude isn't 0)
+  * @retval NON_HAL_ERROR if the number doesn't fit in the field
+  */
+static NON_HAL_StatusTypeDef Non_HAL_Disp_Set(Non_HAL_Disp_Field_Struct *pField, uint32_t magnitude, bool negative)
+{
+  uint8_t *text = pField->text;
+  uint8_t next[NON_HAL_DISP_MAX_WIDTH];
+  NON_HAL_StatusTypeDef status;
+  int32_t first;
+  int32_t last;
+
+  if(pField->valid && magnitude == pField->magnitude && negative == pField->negative)
+  {
+    return NON_HAL_OK;
+  }
+
+  // a counter step: the carry goes only through trailing nines
+  if(pField->valid && !negative && !pField->negative && magnitude == pField->magnitude + 1U && magnitude != 0)
+  {
+    int32_t i = pField->width - 1;
+    for(; i >= 0; i--)
+    {
+      if(text[i] == '.')
+      {
+        continue;
+      }
+      if(text[i] == '9')
+      {
+        text[i] = '0';
+        continue;
+      }
+      text[i] = (text[i] == ' ') ? '1' : (uint8_t)(text[i] + 1U);
+      break;
+    }
+    if(i >= 0)
+    {
+      pField->magnitude = magnitude;
+      Non_HAL_Disp_Mark(pField, (uint8_t)i, pField->width);
+      return NON_HAL_OK;
+    }
+    // all digits were nines and the field is full, the new value doesn't fit
+  }
+
+  // other values: format all symbols and compare them with the field
+  status = Non_HAL_Disp_Format(pField, magnitude, negative, next);
+  for(first = 0; first < pField->width && next[first] == text[first]; first++)
+  {
+  }
+  for(last = pField->width - 1; last >= first && next[last] == text[last]; last--)
+  {
+  }
+  if(first <= last)
+  {
+    memcpy(text + first, next + first, (size_t)(last - first + 1));
+    Non_HAL_Disp_Mark(pField, (uint8_t)first, (uint8_t)(last + 1));
+  }
+  pField->magnitude = magnitude;
+  pField->negative = negative;
+  pField->valid = (status == NON_HAL_OK);
+  return status;
+}
+
+/**
+  * @brief  The function to initial a numeric field of a display
+  * @note   The field is filled with spaces and the whole field is dirty.
+  * @param  pField a pointer on a empty Non_HAL_Disp_Field_Struct structure
+  * @param  text a pointer on a buffer of width + 1 symbols
+  * @param  width a number of symbols of the field (from 1 to NON_HAL_DISP_MAX_WIDTH)
+  * @param  decimals a number of digits after the point (from 0 to
+  *         NON_HAL_DISP_MAX_DECIMALS), integer values are shown as fixed-point
+  *         values (e.g. 1234 with 2 decimals is 12.34)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Disp_Init(Non_HAL_Disp_Field_Struct *pField, uint8_t *text, uint8_t width,
+                                        uint8_t decimals)
+{
+  if(text == NULL || width == 0 || width > NON_HAL_DISP_MAX_WIDTH || decimals > NON_HAL_DISP_MAX_DECIMALS)
+  {
+    return NON_HAL_ERROR;
+  }
+  pField->text = text;
+  pField->width = width;
+  pField->decimals = decimals;
+  memset(text, ' ', width);
+  text[width] = 0;
+  pField->magnitude = 0;
+  pField->negative = false;
+  pField->valid = false;
+  pField->first = 0;
+  pField->end = width;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to show an uint32_t value in the field
+  * @note   If the value doesn't fit in the field, the field is filled with '#'.
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @param  data an uint32_t value (a fixed-point value if decimals isn't 0)
+  * @retval NON_HAL_ERROR if the value doesn't fit in the field
+  */
+NON_HAL_StatusTypeDef Non_HAL_Disp_Set_UInt(Non_HAL_Disp_Field_Struct *pField, uint32_t data)
+{
+  return Non_HAL_Disp_Set(pField, data, false);
+}
+
+/**
+  * @brief  The function to show an int32_t value in the field
+  * @note   If the value doesn't fit in the field, the field is filled with '#'.
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @param  data an int32_t value (a fixed-point value if decimals isn't 0)
+  * @retval NON_HAL_ERROR if the value doesn't fit in the field
+  */
+NON_HAL_StatusTypeDef Non_HAL_Disp_Set_Int(Non_HAL_Disp_Field_Struct *pField, int32_t data)
+{
+  uint32_t magnitude = (data < 0) ? 0U - (uint32_t)data : (uint32_t)data;
+  return Non_HAL_Disp_Set(pField, magnitude, data < 0);
+}
+
+/**
+  * @brief  The function to show a float value in the field with decimals
+  *         digits after the point
+  * @note   The value is rounded half away from zero, a value which rounds to
+  *         0 is shown without the minus sign.
+  * @note   If the value doesn't fit in the field, its scaled value doesn't fit
+  *         in uint32_t or it is nan, the field is filled with '#'.
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @param  data a float value
+  * @retval NON_HAL_ERROR if the value doesn't fit in the field
+  */
+NON_HAL_StatusTypeDef Non_HAL_Disp_Set_Float(Non_HAL_Disp_Field_Struct *pField, float data)
+{
+  bool negative = (data < 0.0f);
+  float scaled = (negative ? -data : data) * disp_pow10_table[pField->decimals] + 0.5f;
+  if(!(scaled < 4294967296.0f))
+  {
+    // too large or nan
+    Non_HAL_Disp_Invalidate(pField);
+    memset(pField->text, '#', pField->width);
+    return NON_HAL_ERROR;
+  }
+  uint32_t magnitude = (uint32_t)scaled;
+  return Non_HAL_Disp_Set(pField, magnitude, negative && magnitude != 0);
+}
+
+/**
+  * @brief  The function to take the span of symbols which changed since
+  *         the last call, the span becomes clean
+  * @note   Changes between two calls are merged, so the display can be
+  *         redrawn less often than the values change.
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @param  first a pointer on the first changed symbol (pField->text + first)
+  * @retval a number of changed symbols to redraw (0 if nothing changed)
+  */
+uint8_t Non_HAL_Disp_Take_Dirty(Non_HAL_Disp_Field_Struct *pField, uint8_t *first)
+{
+  uint8_t length = pField->end - pField->first;
+  *first = pField->first;
+  pField->first = 0;
+  pField->end = 0;
+  return length;
+}
+
+/**
+  * @brief  The function to mark the whole field dirty (e.g. after the display
+  *         was cleared), the next value is formatted completely
+  * @param  pField a pointer on a Non_HAL_Disp_Field_Struct structure
+  * @retval None
+  */
+void Non_HAL_Disp_Invalidate(Non_HAL_Disp_Field_Struct *pField)
+{
+  pField->valid = false;
+  pField->first = 0;
+  pField->end = pField->width;
+}
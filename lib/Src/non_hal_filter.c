@@ -0,0 +1,558 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_filter.c
+  * @brief      This file provides functions to filter data with the moving
+  *             average, the exponential moving average, the sliding median
+  *             and the alpha-beta filters.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_lib.h"
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of values in the min-heap of the sliding median filter
+  */
+#define FILT_MED_MIN_COUNT(DATA)   (((DATA)->count - 1) / 2)
+
+/** @brief A number of values in the max-heap of the sliding median filter
+  */
+#define FILT_MED_MAX_COUNT(DATA)   ((DATA)->count / 2)
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function to initial parameters for the moving average filter
+  * @param  pData a pointer on a empty Filter_Average_Struct structure
+  * @param  pBuffer a pointer on a buffer of size values for the window
+  * @param  size a size of the window (> 0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Avg_Init(Filter_Average_Struct *pData, float *pBuffer, uint32_t size)
+{
+  if(pBuffer == NULL || size == 0)
+  {
+    return NON_HAL_ERROR;
+  }
+  pData->buffer = pBuffer;
+  pData->size = size;
+  pData->index = 0;
+  pData->count = 0;
+  pData->sum = 0.0f;
+  pData->lap = 0.0f;
+  pData->scale = 1.0f / (float)size;
+  for(uint32_t i = 0; i < size; i++)
+  {
+    pBuffer[i] = 0.0f;
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the moving average filter.
+  * @note   The sum of the window is updated with one addition and one
+  *         subtraction per value. To stop the rounding error of the running
+  *         sum from growing, the sum is replaced every size values by the
+  *         sum of the values of the last lap, which is exactly the window.
+  *         The error doesn't grow with time, relative to the mean of
+  *         absolute values of the window it is below
+  *         1e-7 * (2 + sqrt(size)) (noisy sine at an offset of 1000, sizes
+  *         from 1 to 4096, checked by tests/test_filter.c). Until the window
+  *         is full the average of the received values is returned.
+  * @param  pData a pointer on an initialized Filter_Average_Struct structure
+  * @param  value a input value
+  * @retval a output value past the moving average filtering
+  */
+float Filt_Avg(Filter_Average_Struct *pData, float value)
+{
+  uint32_t index = pData->index;
+
+  pData->sum += value - pData->buffer[index];
+  pData->lap += value;
+  pData->buffer[index] = value;
+  if(++index == pData->size)
+  {
+    index = 0;
+    pData->sum = pData->lap;
+    pData->lap = 0.0f;
+  }
+  pData->index = index;
+
+  if(pData->count < pData->size)
+  {
+    pData->count++;
+    return pData->sum / (float)pData->count;
+  }
+  return pData->sum * pData->scale;
+}
+
+/**
+  * @brief  The function to filter a block of data with the moving average
+  *         filter.
+  * @note   The result is bit-identical to calling Filt_Avg() for every
+  *         sample of the block. The function supports in-place filtering
+  *         (in == out).
+  * @param  pData a pointer on an initialized Filter_Average_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  out a pointer on an array for output values
+  * @param  n a number of values in the arrays
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Avg_Block(Filter_Average_Struct *pData, const float *in, float *out, size_t n)
+{
+  float *buffer = pData->buffer;
+  uint32_t size = pData->size;
+  float scale = pData->scale;
+  uint32_t index;
+  float sum;
+  float lap;
+  size_t i = 0;
+
+  for(; i < n && pData->count < size; i++)
+  {
+    out[i] = Filt_Avg(pData, in[i]);
+  }
+  index = pData->index;
+  sum = pData->sum;
+  lap = pData->lap;
+
+  for(; i < n; i++)
+  {
+    float value = in[i];
+    sum += value - buffer[index];
+    lap += value;
+    buffer[index] = value;
+    if(++index == size)
+    {
+      index = 0;
+      sum = lap;
+      lap = 0.0f;
+    }
+    out[i] = sum * scale;
+  }
+
+  pData->index = index;
+  pData->sum = sum;
+  pData->lap = lap;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to initial parameters for the exponential moving
+  *         average filter
+  * @param  pData a pointer on a empty Filter_EMA_Struct structure
+  * @param  Alpha a smoothing factor (from 0 to 1, 1 passes values unchanged)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_EMA_Init(Filter_EMA_Struct *pData, float Alpha)
+{
+  if(!(Alpha > 0.0f && Alpha <= 1.0f))
+  {
+    return NON_HAL_ERROR;
+  }
+  pData->alpha = Alpha;
+  pData->lastestimate = 0.0f;
+  pData->primed = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the exponential moving average
+  *         filter.
+  * @note   The first value is returned unchanged and starts the filter.
+  * @param  pData a pointer on an initialized Filter_EMA_Struct structure
+  * @param  value a input value
+  * @retval a output value past the exponential moving average filtering
+  */
+float Filt_EMA(Filter_EMA_Struct *pData, float value)
+{
+  if(!pData->primed)
+  {
+    pData->primed = 1;
+    pData->lastestimate = value;
+    return value;
+  }
+  pData->lastestimate += pData->alpha * (value - pData->lastestimate);
+  return pData->lastestimate;
+}
+
+/**
+  * @brief  The function to filter a block of data with the exponential moving
+  *         average filter.
+  * @note   The result is bit-identical to calling Filt_EMA() for every
+  *         sample of the block. The function supports in-place filtering
+  *         (in == out).
+  * @param  pData a pointer on an initialized Filter_EMA_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  out a pointer on an array for output values
+  * @param  n a number of values in the arrays
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_EMA_Block(Filter_EMA_Struct *pData, const float *in, float *out, size_t n)
+{
+  float alpha = pData->alpha;
+  float lastestimate;
+  size_t i = 0;
+
+  if(n != 0 && !pData->primed)
+  {
+    out[0] = Filt_EMA(pData, in[0]);
+    i = 1;
+  }
+  lastestimate = pData->lastestimate;
+  for(; i < n; i++)
+  {
+    lastestimate += alpha * (in[i] - lastestimate);
+    out[i] = lastestimate;
+  }
+  pData->lastestimate = lastestimate;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to compare two values of the heap of the sliding
+  *         median filter
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  i a position in the heap
+  * @param  j a position in the heap
+  * @retval 1 if the value at i is less than the value at j, 0 otherwise
+  */
+static inline int Filt_Med_Less(const Filter_Median_Struct *pData, int32_t i, int32_t j)
+{
+  return pData->buffer[pData->heap[i]] < pData->buffer[pData->heap[j]];
+}
+
+/**
+  * @brief  The function to swap two values of the heap of the sliding median
+  *         filter if the value at i is less than the value at j
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  i a position in the heap
+  * @param  j a position in the heap
+  * @retval 1 if the values are swapped, 0 otherwise
+  */
+static inline int Filt_Med_Swap(Filter_Median_Struct *pData, int32_t i, int32_t j)
+{
+  int16_t t;
+
+  if(!Filt_Med_Less(pData, i, j))
+  {
+    return 0;
+  }
+  t = pData->heap[i];
+  pData->heap[i] = pData->heap[j];
+  pData->heap[j] = t;
+  pData->pos[pData->heap[i]] = (int16_t)i;
+  pData->pos[pData->heap[j]] = (int16_t)j;
+  return 1;
+}
+
+/**
+  * @brief  The function to restore the min-heap below the parent of i
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  i a position in the min-heap (> 0)
+  * @retval None
+  */
+static void Filt_Med_Min_Down(Filter_Median_Struct *pData, int32_t i)
+{
+  for(; i <= FILT_MED_MIN_COUNT(pData); i *= 2)
+  {
+    if(i > 1 && i < FILT_MED_MIN_COUNT(pData) && Filt_Med_Less(pData, i + 1, i))
+    {
+      i++;
+    }
+    if(!Filt_Med_Swap(pData, i, i / 2))
+    {
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  The function to restore the max-heap below the parent of i
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  i a position in the max-heap (< 0)
+  * @retval None
+  */
+static void Filt_Med_Max_Down(Filter_Median_Struct *pData, int32_t i)
+{
+  for(; i >= -FILT_MED_MAX_COUNT(pData); i *= 2)
+  {
+    if(i < -1 && i > -FILT_MED_MAX_COUNT(pData) && Filt_Med_Less(pData, i, i - 1))
+    {
+      i--;
+    }
+    if(!Filt_Med_Swap(pData, i / 2, i))
+    {
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  The function to restore the min-heap above i (with the median)
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  i a position in the min-heap (> 0)
+  * @retval 1 if the value reached the median, 0 otherwise
+  */
+static int Filt_Med_Min_Up(Filter_Median_Struct *pData, int32_t i)
+{
+  while(i > 0 && Filt_Med_Swap(pData, i, i / 2))
+  {
+    i /= 2;
+  }
+  return i == 0;
+}
+
+/**
+  * @brief  The function to restore the max-heap above i (with the median)
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  i a position in the max-heap (< 0)
+  * @retval 1 if the value reached the median, 0 otherwise
+  */
+static int Filt_Med_Max_Up(Filter_Median_Struct *pData, int32_t i)
+{
+  while(i < 0 && Filt_Med_Swap(pData, i / 2, i))
+  {
+    i /= 2;
+  }
+  return i == 0;
+}
+
+/**
+  * @brief  The function to initial parameters for the sliding median filter
+  * @param  pData a pointer on a empty Filter_Median_Struct structure
+  * @param  pBuffer a pointer on a buffer of size values for the window
+  * @param  pIndex a pointer on a buffer of FILT_MED_INDEX_SIZE(size) values
+  *         for the heap
+  * @param  size a size of the window (from 1 to FILT_MED_MAX_SIZE)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Med_Init(Filter_Median_Struct *pData, float *pBuffer, int16_t *pIndex, uint32_t size)
+{
+  if(pBuffer == NULL || pIndex == NULL || size == 0 || size > FILT_MED_MAX_SIZE)
+  {
+    return NON_HAL_ERROR;
+  }
+  pData->buffer = pBuffer;
+  pData->pos = pIndex;
+  pData->heap = pIndex + size + size / 2U;
+  pData->size = (int32_t)size;
+  pData->index = 0;
+  pData->count = 0;
+  // values fill the heap in the order: the median, max, min, max, min...
+  for(int32_t i = 0; i < (int32_t)size; i++)
+  {
+    pData->buffer[i] = 0.0f;
+    pData->pos[i] = (int16_t)(((i + 1) / 2) * ((i & 1) ? -1 : 1));
+    pData->heap[pData->pos[i]] = (int16_t)i;
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the sliding median filter.
+  * @note   The window is kept as a max-heap of smaller values and a min-heap
+  *         of bigger values around the median. A new value replaces the
+  *         oldest one in its place of the heap and it is sifted up or down,
+  *         so a value costs O(log size) comparisons. Until the window is full
+  *         the median of the received values is returned. For even number of
+  *         values the mean of two middle values is returned.
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  value a input value
+  * @retval a output value past the sliding median filtering
+  */
+float Filt_Med(Filter_Median_Struct *pData, float value)
+{
+  int32_t fresh = pData->count < pData->size;
+  int32_t p = pData->pos[pData->index];
+  float old = pData->buffer[pData->index];
+  float median;
+
+  pData->buffer[pData->index] = value;
+  if(++pData->index == pData->size)
+  {
+    pData->index = 0;
+  }
+  pData->count += fresh;
+
+  if(p > 0)
+  {
+    if(!fresh && old < value)
+    {
+      Filt_Med_Min_Down(pData, p * 2);
+    }
+    else if(Filt_Med_Min_Up(pData, p))
+    {
+      Filt_Med_Max_Down(pData, -1);
+    }
+  }
+  else if(p < 0)
+  {
+    if(!fresh && value < old)
+    {
+      Filt_Med_Max_Down(pData, p * 2);
+    }
+    else if(Filt_Med_Max_Up(pData, p))
+    {
+      Filt_Med_Min_Down(pData, 1);
+    }
+  }
+  else
+  {
+    if(FILT_MED_MAX_COUNT(pData))
+    {
+      Filt_Med_Max_Down(pData, -1);
+    }
+    if(FILT_MED_MIN_COUNT(pData))
+    {
+      Filt_Med_Min_Down(pData, 1);
+    }
+  }
+
+  median = pData->buffer[pData->heap[0]];
+  if((pData->count & 1) == 0)
+  {
+    median = (median + pData->buffer[pData->heap[-1]]) * 0.5f;
+  }
+  return median;
+}
+
+/**
+  * @brief  The function to filter a block of data with the sliding median
+  *         filter.
+  * @note   The function supports in-place filtering (in == out).
+  * @param  pData a pointer on an initialized Filter_Median_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  out a pointer on an array for output values
+  * @param  n a number of values in the arrays
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Med_Block(Filter_Median_Struct *pData, const float *in, float *out, size_t n)
+{
+  for(size_t i = 0; i < n; i++)
+  {
+    out[i] = Filt_Med(pData, in[i]);
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to initial parameters for the alpha-beta filter
+  * @param  pData a pointer on a empty Filter_Alpha_Beta_Struct structure
+  * @param  Alpha a gain of the value (from 0 to 1)
+  * @param  Beta a gain of the rate of change (from 0 to 4 - 2 * Alpha, the
+  *         filter is unstable otherwise)
+  * @param  Dt a sample period (> 0)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_AB_Init(Filter_Alpha_Beta_Struct *pData, float Alpha, float Beta, float Dt)
+{
+  if(!(Alpha > 0.0f && Alpha <= 1.0f) || !(Beta >= 0.0f && Beta < 4.0f - 2.0f * Alpha) || !(Dt > 0.0f))
+  {
+    return NON_HAL_ERROR;
+  }
+  pData->alpha = Alpha;
+  pData->beta = Beta / Dt;
+  pData->dt = Dt;
+  pData->lastestimate = 0.0f;
+  pData->speed = 0.0f;
+  pData->primed = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the alpha-beta filter.
+  * @note   The first value is returned unchanged and starts the filter with
+  *         zero rate of change.
+  * @param  pData a pointer on an initialized Filter_Alpha_Beta_Struct structure
+  * @param  value a input value
+  * @retval currentestimate a output value past the alpha-beta filtering
+  */
+float Filt_AB(Filter_Alpha_Beta_Struct *pData, float value)
+{
+  float currentestimate;
+  float residual;
+
+  if(!pData->primed)
+  {
+    pData->primed = 1;
+    pData->lastestimate = value;
+    return value;
+  }
+  currentestimate = pData->lastestimate + pData->speed * pData->dt;
+  residual = value - currentestimate;
+  currentestimate += pData->alpha * residual;
+  pData->speed += pData->beta * residual;
+  pData->lastestimate = currentestimate;
+  return currentestimate;
+}
+
+/**
+  * @brief  The function to filter a block of data with the alpha-beta filter.
+  * @note   The result is bit-identical to calling Filt_AB() for every sample
+  *         of the block. The function supports in-place filtering (in == out).
+  * @param  pData a pointer on an initialized Filter_Alpha_Beta_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  out a pointer on an array for output values
+  * @param  n a number of values in the arrays
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_AB_Block(Filter_Alpha_Beta_Struct *pData, const float *in, float *out, size_t n)
+{
+  float alpha = pData->alpha;
+  float beta = pData->beta;
+  float dt = pData->dt;
+  float lastestimate;
+  float speed;
+  size_t i = 0;
+
+  if(n != 0 && !pData->primed)
+  {
+    out[0] = Filt_AB(pData, in[0]);
+    i = 1;
+  }
+  lastestimate = pData->lastestimate;
+  speed = pData->speed;
+  for(; i < n; i++)
+  {
+    float currentestimate = lastestimate + speed * dt;
+    float residual = in[i] - currentestimate;
+    currentestimate += alpha * residual;
+    speed += beta * residual;
+    lastestimate = currentestimate;
+    out[i] = currentestimate;
+  }
+  pData->lastestimate = lastestimate;
+  pData->speed = speed;
+  return NON_HAL_OK;
+}
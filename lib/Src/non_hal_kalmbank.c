@@ -0,0 +1,384 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_kalmbank.c
+  * @brief      This file provides functions to filter several channels of data
+  *             with a bank of the fast Kalman filters.
+  *
+  *             The state of the bank is stored as parallel arrays (one array
+  *             per parameter), so one step of the bank can update several
+  *             channels with one SIMD instruction. The kernels are:
+  *               - scalar - portable;
+  *               - SSE    - x86 hosts, 4 channels per instruction;
+  *               - AVX2   - x86 hosts, 8 channels per instruction;
+  *               - NEON   - ARM cores with Advanced SIMD, 4 channels per
+  *                          instruction.
+  *
+  *             The SSE and AVX2 kernels do the same float operations in the
+  *             same order as Filt_Kalm, so they are bit-identical to it unless
+  *             the compiler contracts Filt_Kalm into FMA instructions
+  *             (-ffp-contract=fast). The NEON kernel of ARMv7 computes the
+  *             Kalman Gain with a reciprocal estimate, its outputs differ from
+  *             Filt_Kalm by less than 1e-4 * max(|output|, 1).
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_lib.h"
+#include <math.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define FILT_KALM_BANK_USE_X86
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FILT_KALM_BANK_USE_NEON
+#endif
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The portable kernel to update channels of the bank starting from
+  *         the first channel
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  in a pointer on an array of input values (one value per channel)
+  * @param  out a pointer on an array for output values (one value per channel)
+  * @param  first a number of the first channel to update
+  * @retval None
+  */
+static void Filt_Kalm_Bank_Scalar(Filter_Kalman_Bank_Struct *pBank, const float *in, float *out, uint32_t first)
+{
+  for(uint32_t i = first; i < pBank->channels; i++)
+  {
+    float errestimate = pBank->errestimate[i];
+    float lastestimate = pBank->lastestimate[i];
+    float kalmangain = errestimate / (errestimate + pBank->errmeasure[i]);
+    float currentestimate = lastestimate + kalmangain * (in[i] - lastestimate);
+    pBank->errestimate[i] = (1.0f - kalmangain) * errestimate +\
+                            fabsf(lastestimate - currentestimate) * pBank->speed[i];
+    pBank->lastestimate[i] = currentestimate;
+    pBank->kalmangain[i] = kalmangain;
+    out[i] = currentestimate;
+  }
+}
+
+#if defined(FILT_KALM_BANK_USE_X86)
+
+/**
+  * @brief  The SSE kernel to update all channels of the bank
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  in a pointer on an array of input values (one value per channel)
+  * @param  out a pointer on an array for output values (one value per channel)
+  * @retval None
+  */
+__attribute__((target("sse")))
+static void Filt_Kalm_Bank_SSE(Filter_Kalman_Bank_Struct *pBank, const float *in, float *out)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 sign = _mm_set1_ps(-0.0f);
+  uint32_t i = 0;
+
+  for(; i + 4 <= pBank->channels; i += 4)
+  {
+    __m128 errestimate = _mm_loadu_ps(&pBank->errestimate[i]);
+    __m128 lastestimate = _mm_loadu_ps(&pBank->lastestimate[i]);
+    __m128 kalmangain = _mm_div_ps(errestimate, _mm_add_ps(errestimate, _mm_loadu_ps(&pBank->errmeasure[i])));
+    __m128 currentestimate = _mm_add_ps(lastestimate,
+                                        _mm_mul_ps(kalmangain, _mm_sub_ps(_mm_loadu_ps(&in[i]), lastestimate)));
+    errestimate = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(one, kalmangain), errestimate),
+                             _mm_mul_ps(_mm_andnot_ps(sign, _mm_sub_ps(lastestimate, currentestimate)),
+                                        _mm_loadu_ps(&pBank->speed[i])));
+    _mm_storeu_ps(&pBank->errestimate[i], errestimate);
+    _mm_storeu_ps(&pBank->lastestimate[i], currentestimate);
+    _mm_storeu_ps(&pBank->kalmangain[i], kalmangain);
+    _mm_storeu_ps(&out[i], currentestimate);
+  }
+  Filt_Kalm_Bank_Scalar(pBank, in, out, i);
+}
+
+/**
+  * @brief  The AVX2 kernel to update all channels of the bank
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  in a pointer on an array of input values (one value per channel)
+  * @param  out a pointer on an array for output values (one value per channel)
+  * @retval None
+  */
+__attribute__((target("avx2")))
+static void Filt_Kalm_Bank_AVX2(Filter_Kalman_Bank_Struct *pBank, const float *in, float *out)
+{
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 sign = _mm256_set1_ps(-0.0f);
+  uint32_t i = 0;
+
+  for(; i + 8 <= pBank->channels; i += 8)
+  {
+    __m256 errestimate = _mm256_loadu_ps(&pBank->errestimate[i]);
+    __m256 lastestimate = _mm256_loadu_ps(&pBank->lastestimate[i]);
+    __m256 kalmangain = _mm256_div_ps(errestimate,
+                                      _mm256_add_ps(errestimate, _mm256_loadu_ps(&pBank->errmeasure[i])));
+    __m256 currentestimate = _mm256_add_ps(lastestimate,
+                                           _mm256_mul_ps(kalmangain,
+                                                         _mm256_sub_ps(_mm256_loadu_ps(&in[i]), lastestimate)));
+    errestimate = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(one, kalmangain), errestimate),
+                                _mm256_mul_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(lastestimate, currentestimate)),
+                                              _mm256_loadu_ps(&pBank->speed[i])));
+    _mm256_storeu_ps(&pBank->errestimate[i], errestimate);
+    _mm256_storeu_ps(&pBank->lastestimate[i], currentestimate);
+    _mm256_storeu_ps(&pBank->kalmangain[i], kalmangain);
+    _mm256_storeu_ps(&out[i], currentestimate);
+  }
+  _mm256_zeroupper(); // the scalar tail uses legacy SSE instructions
+  Filt_Kalm_Bank_Scalar(pBank, in, out, i);
+}
+
+#endif /* FILT_KALM_BANK_USE_X86 */
+
+#if defined(FILT_KALM_BANK_USE_NEON)
+
+/**
+  * @brief  The NEON kernel to update all channels of the bank
+  * @note   ARMv7 NEON has no division, so the Kalman Gain is computed with
+  *         the reciprocal estimate and two Newton-Raphson steps.
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  in a pointer on an array of input values (one value per channel)
+  * @param  out a pointer on an array for output values (one value per channel)
+  * @retval None
+  */
+static void Filt_Kalm_Bank_NEON(Filter_Kalman_Bank_Struct *pBank, const float *in, float *out)
+{
+  const float32x4_t one = vdupq_n_f32(1.0f);
+  uint32_t i = 0;
+
+  for(; i + 4 <= pBank->channels; i += 4)
+  {
+    float32x4_t errestimate = vld1q_f32(&pBank->errestimate[i]);
+    float32x4_t lastestimate = vld1q_f32(&pBank->lastestimate[i]);
+    float32x4_t sum = vaddq_f32(errestimate, vld1q_f32(&pBank->errmeasure[i]));
+#if defined(__aarch64__)
+    float32x4_t kalmangain = vdivq_f32(errestimate, sum);
+#else
+    float32x4_t reciprocal = vrecpeq_f32(sum);
+    reciprocal = vmulq_f32(vrecpsq_f32(sum, reciprocal), reciprocal);
+    reciprocal = vmulq_f32(vrecpsq_f32(sum, reciprocal), reciprocal);
+    float32x4_t kalmangain = vmulq_f32(errestimate, reciprocal);
+#endif
+    float32x4_t currentestimate = vaddq_f32(lastestimate,
+                                            vmulq_f32(kalmangain, vsubq_f32(vld1q_f32(&in[i]), lastestimate)));
+    errestimate = vaddq_f32(vmulq_f32(vsubq_f32(one, kalmangain), errestimate),
+                            vmulq_f32(vabsq_f32(vsubq_f32(lastestimate, currentestimate)),
+                                      vld1q_f32(&pBank->speed[i])));
+    vst1q_f32(&pBank->errestimate[i], errestimate);
+    vst1q_f32(&pBank->lastestimate[i], currentestimate);
+    vst1q_f32(&pBank->kalmangain[i], kalmangain);
+    vst1q_f32(&out[i], currentestimate);
+  }
+  Filt_Kalm_Bank_Scalar(pBank, in, out, i);
+}
+
+#endif /* FILT_KALM_BANK_USE_NEON */
+
+/**
+  * @brief  The function to check if a kernel can run on this core
+  * @param  kernel a kernel to check
+  * @retval true if the kernel is available
+  */
+static bool Filt_Kalm_Bank_Kernel_Available(Filter_Kalman_Bank_Kernel kernel)
+{
+  switch(kernel)
+  {
+    case FILT_KALM_BANK_SCALAR:
+      return true;
+#if defined(FILT_KALM_BANK_USE_X86)
+    case FILT_KALM_BANK_SSE:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse");
+    case FILT_KALM_BANK_AVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#endif
+#if defined(FILT_KALM_BANK_USE_NEON)
+    case FILT_KALM_BANK_NEON:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+/**
+  * @brief  The function to initial parameters for the bank of the fast Kalman
+  *         filters. All channels get the same parameters, the fastest kernel
+  *         available on this core is chosen.
+  * @param  pBank a pointer on an empty Filter_Kalman_Bank_Struct structure
+  * @param  pWork a pointer on a work buffer, which must be least
+  *         FILT_KALM_BANK_WORK_SIZE(channels) floats
+  * @param  channels a number of channels
+  * @param  ErrMeasure a predicted input date standard deviation
+  * @param  Speed a rate of change of output values (from 0,001 to 1)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Init(Filter_Kalman_Bank_Struct *pBank, float *pWork, uint32_t channels,
+                                          float ErrMeasure, float Speed)
+{
+  if(channels == 0)
+  {
+    return NON_HAL_ERROR;
+  }
+  pBank->errmeasure = pWork;
+  pBank->errestimate = pWork + channels;
+  pBank->speed = pWork + 2 * channels;
+  pBank->lastestimate = pWork + 3 * channels;
+  pBank->kalmangain = pWork + 4 * channels;
+  pBank->channels = channels;
+  for(uint32_t i = 0; i < channels; i++)
+  {
+    pBank->errmeasure[i] = ErrMeasure;
+    pBank->errestimate[i] = ErrMeasure;
+    pBank->speed[i] = Speed;
+    pBank->lastestimate[i] = 0.0;
+    pBank->kalmangain[i] = 0.0;
+  }
+
+  if(Filt_Kalm_Bank_Kernel_Available(FILT_KALM_BANK_AVX2))
+  {
+    pBank->kernel = FILT_KALM_BANK_AVX2;
+  }
+  else if(Filt_Kalm_Bank_Kernel_Available(FILT_KALM_BANK_SSE))
+  {
+    pBank->kernel = FILT_KALM_BANK_SSE;
+  }
+  else if(Filt_Kalm_Bank_Kernel_Available(FILT_KALM_BANK_NEON))
+  {
+    pBank->kernel = FILT_KALM_BANK_NEON;
+  }
+  else
+  {
+    pBank->kernel = FILT_KALM_BANK_SCALAR;
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to choose a kernel of the bank manually
+  * @note   Use FILT_KALM_BANK_SCALAR if outputs must be bit-identical
+  *         to Filt_Kalm.
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  kernel a kernel to use
+  * @retval NON_HAL_StatusTypeDef (NON_HAL_ERROR if the kernel can't run on this core)
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Set_Kernel(Filter_Kalman_Bank_Struct *pBank, Filter_Kalman_Bank_Kernel kernel)
+{
+  if(!Filt_Kalm_Bank_Kernel_Available(kernel))
+  {
+    return NON_HAL_ERROR;
+  }
+  pBank->kernel = kernel;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to copy a state of a single fast Kalman filter
+  *         to a channel of the bank
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  channel a number of the channel
+  * @param  pData a pointer on a Filter_Kalman_Struct structure to copy from
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Load(Filter_Kalman_Bank_Struct *pBank, uint32_t channel,
+                                          const Filter_Kalman_Struct *pData)
+{
+  if(channel >= pBank->channels)
+  {
+    return NON_HAL_ERROR;
+  }
+  pBank->errmeasure[channel] = pData->errmeasure;
+  pBank->errestimate[channel] = pData->errestimate;
+  pBank->speed[channel] = pData->speed;
+  pBank->lastestimate[channel] = pData->lastestimate;
+  pBank->kalmangain[channel] = pData->kalmangain;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to copy a state of a channel of the bank to a single
+  *         fast Kalman filter
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  channel a number of the channel
+  * @param  pData a pointer on a Filter_Kalman_Struct structure to copy to
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Bank_Store(const Filter_Kalman_Bank_Struct *pBank, uint32_t channel,
+                                           Filter_Kalman_Struct *pData)
+{
+  if(channel >= pBank->channels)
+  {
+    return NON_HAL_ERROR;
+  }
+  pData->errmeasure = pBank->errmeasure[channel];
+  pData->errestimate = pBank->errestimate[channel];
+  pData->speed = pBank->speed[channel];
+  pData->lastestimate = pBank->lastestimate[channel];
+  pData->kalmangain = pBank->kalmangain[channel];
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter one sample of every channel with the bank of
+  *         the fast Kalman filters
+  * @param  pBank a pointer on an initialized Filter_Kalman_Bank_Struct structure
+  * @param  in a pointer on an array of input values (one value per channel)
+  * @param  out a pointer on an array for output values (one value per channel),
+  *         it can be the same array as in
+  * @retval None
+  */
+void Filt_Kalm_Bank(Filter_Kalman_Bank_Struct *pBank, const float *in, float *out)
+{
+  switch(pBank->kernel)
+  {
+#if defined(FILT_KALM_BANK_USE_X86)
+    case FILT_KALM_BANK_SSE:
+      Filt_Kalm_Bank_SSE(pBank, in, out);
+      break;
+    case FILT_KALM_BANK_AVX2:
+      Filt_Kalm_Bank_AVX2(pBank, in, out);
+      break;
+#endif
+#if defined(FILT_KALM_BANK_USE_NEON)
+    case FILT_KALM_BANK_NEON:
+      Filt_Kalm_Bank_NEON(pBank, in, out);
+      break;
+#endif
+    default:
+      Filt_Kalm_Bank_Scalar(pBank, in, out, 0);
+      break;
+  }
+}
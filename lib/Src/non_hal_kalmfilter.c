@@ -34,14 +34,107 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "non_hal_lib.h"
+#include "non_hal_kalmfilter.h"
 #include "math.h"
+#include <float.h>
+#include <stdlib.h>
 
 /* Types ---------------------------------------------------------------------*/
 /* Variables -----------------------------------------------------------------*/
 /* Constants -----------------------------------------------------------------*/
 /* Macros --------------------------------------------------------------------*/
+
+#if defined(__ARM_FEATURE_IDIV) && !defined(FILT_KALM_USE_UDIV)
+/** @brief The fixed-point Kalman Gain is divided with the 32-bit UDIV of the
+  *        core (Cortex-M3/M4/M7), else with the shift-subtract loop (Cortex-M0)
+  */
+#define FILT_KALM_USE_UDIV
+#endif
+
+#if defined(__GNUC__)
+#define FILT_KALM_CLZ(X)    ((uint32_t)__builtin_clz(X))
+#else
+#define FILT_KALM_CLZ(X)    ((uint32_t)__CLZ(X))
+#endif
+
 /* Functions -----------------------------------------------------------------*/
 
+#if defined(FILT_KALM_USE_UDIV)
+/**
+  * @brief  The function to divide two unsigned values with two 32-bit UDIV
+  *         (the long division by 16-bit digits of Hacker's Delight, divlu)
+  * @note   Cortex-M3/M4 have no 64-bit divider, num << bits doesn't fit in 32
+  *         bits. The divisor is normalized, every digit of the quotient is
+  *         estimated with UDIV by the high half of it and corrected at most
+  *         twice. The result is the same as of the shift-subtract loop.
+  * @param  num a dividend, it must be less than den
+  * @param  den a divisor
+  * @param  bits a number of fractional bits of the quotient (from 1 to 31)
+  * @retval num/den with bits fractional bits (rounded toward zero)
+  */
+static uint32_t Filt_Kalm_Frac_Div(uint32_t num, uint32_t den, uint8_t bits)
+{
+  uint32_t shift = FILT_KALM_CLZ(den);
+  // the dividend num << bits in two words, normalized with the divisor
+  uint32_t high = num >> (32U - bits);
+  uint32_t low = num << bits;
+  den <<= shift;
+  if(shift != 0)
+  {
+    high = (high << shift) | (low >> (32U - shift));
+    low <<= shift;
+  }
+  uint32_t denhigh = den >> 16;
+  uint32_t denlow = den & 0xFFFFU;
+  uint32_t quotient = 0;
+  for(uint8_t digit = 0; digit < 2; digit++)
+  {
+    uint32_t next = (digit == 0) ? (low >> 16) : (low & 0xFFFFU);
+    uint32_t q = high / denhigh;
+    uint32_t rem = high - q * denhigh;
+    while(q > 0xFFFFU || q * denlow > ((rem << 16) | next))
+    {
+      q--;
+      rem += denhigh;
+      if(rem > 0xFFFFU)
+      {
+        break;
+      }
+    }
+    high = ((high << 16) | next) - q * den;
+    quotient = (quotient << 16) | q;
+  }
+  return quotient;
+}
+#else
+/**
+  * @brief  The function to divide two unsigned values with the restoring
+  *         shift-subtract algorithm (without a division instruction)
+  * @note   It is used instead of the division for the fixed-point Kalman
+  *         Gain, because Cortex-M0 has no divider at all.
+  * @param  num a dividend, it must be less than den
+  * @param  den a divisor
+  * @param  bits a number of fractional bits of the quotient
+  * @retval num/den with bits fractional bits (rounded toward zero)
+  */
+static uint32_t Filt_Kalm_Frac_Div(uint32_t num, uint32_t den, uint8_t bits)
+{
+  uint32_t quotient = 0;
+  for(uint8_t i = 0; i < bits; i++)
+  {
+    uint32_t carry = num >> 31;
+    num <<= 1;
+    quotient <<= 1;
+    if(carry || num >= den)
+    {
+      num -= den;
+      quotient |= 1U;
+    }
+  }
+  return quotient;
+}
+#endif
+
 /**
   * @brief  The function to initial parameters for the fast Kalman filter
   * @param  pData a pointer on a empty Filter_Kalman_Struct structure
@@ -70,8 +163,705 @@ float Filt_Kalm(Filter_Kalman_Struct *pData, float value)
   volatile float currentestimate;
   pData->kalmangain = pData->errestimate / (pData->errestimate + pData->errmeasure);
   currentestimate = pData->lastestimate + pData->kalmangain * (value - pData->lastestimate);
-  pData->errestimate =  (1.0 - pData->kalmangain) * pData->errestimate +\
-                        fabs(pData->lastestimate - currentestimate) * pData->speed;
+  pData->errestimate =  (1.0f - pData->kalmangain) * pData->errestimate +\
+                        fabsf(pData->lastestimate - currentestimate) * pData->speed;
   pData->lastestimate = currentestimate;
   return currentestimate;
 }
+
+/**
+  * @brief  The function to filter a block of data with the fast Kalman filter.
+  * @note   The filter state is kept in local variables for the whole block and
+  *         it is written back to the structure once. The result is
+  *         bit-identical to calling Filt_Kalm() for every sample of the block.
+  * @note   The function supports in-place filtering (in == out).
+  * @param  pData a pointer on an initialized Filter_Kalman_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  out a pointer on an array for output values
+  * @param  n a number of values in the arrays
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Block(Filter_Kalman_Struct *pData, const float *in, float *out, size_t n)
+{
+  float errmeasure = pData->errmeasure;
+  float errestimate = pData->errestimate;
+  float speed = pData->speed;
+  float lastestimate = pData->lastestimate;
+  float kalmangain = pData->kalmangain;
+  float currentestimate;
+
+  for(size_t i = 0; i < n; i++)
+  {
+    kalmangain = errestimate / (errestimate + errmeasure);
+    currentestimate = lastestimate + kalmangain * (in[i] - lastestimate);
+    errestimate = (1.0f - kalmangain) * errestimate +\
+                  fabsf(lastestimate - currentestimate) * speed;
+    lastestimate = currentestimate;
+    out[i] = currentestimate;
+  }
+
+  pData->errestimate = errestimate;
+  pData->lastestimate = lastestimate;
+  pData->kalmangain = kalmangain;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to initial parameters for the fast Kalman filter
+  *         in the Q15 format
+  * @param  pData a pointer on a empty Filter_Kalman_Q15_Struct structure
+  * @param  ErrMeasure a predicted input date standard deviation (Q15, > 0)
+  * @param  Speed a rate of change of output values (Q15, from 33 (0,001)
+  *         to 32767 (1))
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Init_Q15(Filter_Kalman_Q15_Struct *pData, int16_t ErrMeasure, int16_t Speed)
+{
+  if(ErrMeasure <= 0 || Speed < 0)
+  {
+    return NON_HAL_ERROR;
+  }
+  pData->errmeasure = (int32_t)ErrMeasure << 15;
+  pData->errestimate = (int32_t)ErrMeasure << 15;
+  pData->speed = Speed;
+  pData->lastestimate = 0;
+  pData->kalmangain = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the fast Kalman filter
+  *         in the Q15 format.
+  * @note   The function uses only 32-bit integer operations (the Kalman Gain
+  *         is divided with UDIV or with shift-subtract on Cortex-M0), so it is
+  *         suitable for Cortex-M0/M3 cores without the FPU.
+  *         The error estimate is kept in Q30 (a Q15 error estimate decays to
+  *         zero at small Speed) and it is saturated to the Q30 range.
+  * @note   Deviation from Filt_Kalm() fed with the same Q15 samples
+  *         (noisy sine with amplitude 0,5 and noise 0,1, ErrMeasure from 0,01
+  *         to 0,2, 30 noise sequences, checked by tests/test_kalmfilter.c):
+  *         Speed | max error, LSB | rms error, LSB
+  *         ----- | -------------- | --------------
+  *         0,001 | 15 - 100       | 5 - 30
+  *         0,01  | 4 - 32         | 1 - 6
+  *         0,1   | 3 - 8          | 0,6 - 1,5
+  *         1     | 2 - 20         | 0,4 - 0,6
+  * @param  pData a pointer on an initialized Filter_Kalman_Q15_Struct structure
+  * @param  value a input value (Q15)
+  * @retval currentestimate a output value past the fast Kalman filtering (Q15)
+  */
+int16_t Filt_Kalm_Q15(Filter_Kalman_Q15_Struct *pData, int16_t value)
+{
+  uint32_t errestimate = (uint32_t)pData->errestimate;
+  int32_t lastestimate = pData->lastestimate;
+  uint32_t kalmangain = Filt_Kalm_Frac_Div(errestimate, errestimate + (uint32_t)pData->errmeasure, 15);
+  int32_t currentestimate = lastestimate + (((int32_t)kalmangain * (value - lastestimate) + (1 << 14)) >> 15);
+  uint32_t delta = (uint32_t)abs(lastestimate - currentestimate);
+  // (1 - kalmangain) * errestimate with the Q30 errestimate split in two Q15 halves
+  errestimate = (0x8000U - kalmangain) * (errestimate >> 15) +\
+                (((0x8000U - kalmangain) * (errestimate & 0x7FFFU) + (1U << 14)) >> 15);
+  errestimate += delta * (uint32_t)pData->speed;
+  pData->errestimate = (errestimate > INT32_MAX) ? INT32_MAX : (int32_t)errestimate;
+  pData->lastestimate = (int16_t)currentestimate;
+  pData->kalmangain = (int16_t)kalmangain;
+  return (int16_t)currentestimate;
+}
+
+/**
+  * @brief  The function to initial parameters for the fast Kalman filter
+  *         in the Q31 format
+  * @param  pData a pointer on a empty Filter_Kalman_Q31_Struct structure
+  * @param  ErrMeasure a predicted input date standard deviation (Q31, > 0)
+  * @param  Speed a rate of change of output values (Q31, from 2147484 (0,001)
+  *         to 2147483647 (1))
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Init_Q31(Filter_Kalman_Q31_Struct *pData, int32_t ErrMeasure, int32_t Speed)
+{
+  if(ErrMeasure <= 0 || Speed < 0)
+  {
+    return NON_HAL_ERROR;
+  }
+  pData->errmeasure = ErrMeasure;
+  pData->errestimate = ErrMeasure;
+  pData->speed = Speed;
+  pData->lastestimate = 0;
+  pData->kalmangain = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the fast Kalman filter
+  *         in the Q31 format.
+  * @note   The function uses 64-bit integer products and no 64-bit division.
+  *         The error estimate is saturated to the Q31 range.
+  * @note   Deviation from Filt_Kalm() (noisy sine with amplitude 0,5 and
+  *         noise 0,1, ErrMeasure from 0,01 to 0,2, 30 noise sequences,
+  *         checked by tests/test_kalmfilter.c) is below 1,5e-5 at Speed = 0,001 and
+  *         below 1e-6 at Speed from 0,01 to 1 (full scale is 1).
+  * @param  pData a pointer on an initialized Filter_Kalman_Q31_Struct structure
+  * @param  value a input value (Q31)
+  * @retval currentestimate a output value past the fast Kalman filtering (Q31)
+  */
+int32_t Filt_Kalm_Q31(Filter_Kalman_Q31_Struct *pData, int32_t value)
+{
+  int64_t errestimate = pData->errestimate;
+  int32_t lastestimate = pData->lastestimate;
+  int64_t kalmangain = Filt_Kalm_Frac_Div((uint32_t)errestimate,
+                                          (uint32_t)errestimate + (uint32_t)pData->errmeasure, 31);
+  int32_t currentestimate = lastestimate +\
+                            (int32_t)((kalmangain * ((int64_t)value - lastestimate) + (1LL << 30)) >> 31);
+  int64_t delta = (int64_t)lastestimate - currentestimate;
+  if(delta < 0)
+  {
+    delta = -delta;
+  }
+  errestimate = ((((1LL << 31) - kalmangain) * errestimate + (1LL << 30)) >> 31) +\
+                ((delta * pData->speed + (1LL << 30)) >> 31);
+  pData->errestimate = (errestimate > INT32_MAX) ? INT32_MAX : (int32_t)errestimate;
+  pData->lastestimate = currentestimate;
+  pData->kalmangain = (int32_t)kalmangain;
+  return currentestimate;
+}
+
+/**
+  * @brief  The function to check the Kalman Gain against the band and to
+  *         freeze it when it stays in the band long enough
+  * @note   When the Gain is frozen, the band is translated to bounds of the
+  *         error estimate (Gain = errestimate / (errestimate + errmeasure)),
+  *         so the frozen filter checks it without a division.
+  * @param  pData a pointer on an initialized Filter_Kalman_Adaptive_Struct structure
+  * @param  gain the Kalman Gain of the current sample
+  * @retval None
+  */
+static void Filt_Kalm_Adaptive_Check(Filter_Kalman_Adaptive_Struct *pData, float gain)
+{
+  float low;
+  float high;
+
+  if(fabsf(gain - pData->anchor) > pData->epsilon * pData->anchor)
+  {
+    pData->anchor = gain;
+    pData->stable = 0;
+    return;
+  }
+  if(++pData->stable < FILT_KALM_ADAPTIVE_SETTLE)
+  {
+    return;
+  }
+
+  low = pData->anchor * (1.0f - pData->epsilon);
+  high = pData->anchor * (1.0f + pData->epsilon);
+  pData->errlow = low * pData->filter.errmeasure / (1.0f - low);
+  pData->errhigh = (high < 1.0f) ? high * pData->filter.errmeasure / (1.0f - high) : INFINITY;
+  pData->frozen = 1;
+  pData->freezes++;
+}
+
+/**
+  * @brief  The function to initial parameters for the fast Kalman filter
+  *         which freezes the converged Kalman Gain
+  * @param  pData a pointer on a empty Filter_Kalman_Adaptive_Struct structure
+  * @param  ErrMeasure a predicted input date standard deviation
+  * @param  Speed a rate of change of output values (from 0,001 to 1)
+  * @param  Epsilon a relative band of the Kalman Gain treated as converged
+  *         (from 0 to 1). The Gain of the filter jitters with the noise by
+  *         about 0,1 % at Speed = 0,001 and by 1 - 10 % at Speed = 0,1, so
+  *         the band must be wider than the jitter (for example 0,02 - 0,2).
+  * @param  Jump an innovation magnitude |value - lastestimate| which returns
+  *         the filter to the division (> 0, for example 3 * ErrMeasure,
+  *         INFINITY disables the check)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Adaptive_Init(Filter_Kalman_Adaptive_Struct *pData, float ErrMeasure, float Speed,
+                                              float Epsilon, float Jump)
+{
+  if(!(Epsilon >= 0.0f && Epsilon < 1.0f) || !(Jump > 0.0f))
+  {
+    return NON_HAL_ERROR;
+  }
+  Filt_Kalm_Init(&pData->filter, ErrMeasure, Speed);
+  pData->epsilon = Epsilon;
+  pData->jump = Jump;
+  pData->anchor = 0.0f;
+  pData->errlow = 0.0f;
+  pData->errhigh = 0.0f;
+  pData->stable = 0;
+  pData->frozen = 0;
+  Filt_Kalm_Adaptive_Reset_Stats(pData);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the fast Kalman filter which
+  *         freezes the converged Kalman Gain.
+  * @note   While the Gain is not frozen, the function is the same as
+  *         Filt_Kalm(). When the Gain stays within epsilon of an anchor value
+  *         for FILT_KALM_ADAPTIVE_SETTLE samples, it is frozen and samples
+  *         are filtered with multiplications and additions only (the error
+  *         estimate is still updated). The Gain is computed again from the
+  *         first sample with an innovation above jump or with the error
+  *         estimate out of the band.
+  * @note   Deviation from Filt_Kalm() and a share of samples without the
+  *         division (noisy sine with amplitude 0,5 and a step of 1, noise
+  *         0,1, ErrMeasure = 0,1, Jump = 0,3, 30 noise sequences, checked
+  *         by tests/test_kalmfilter.c):
+  *         Speed | Epsilon | max error         | frozen
+  *         ----- | ------- | ----------------- | -------
+  *         0,001 | 0,05    | 3,1e-3 - 4,7e-3   | 48 - 49 %
+  *         0,01  | 0,05    | 2,1e-3 - 3,2e-3   | 75 - 77 %
+  *         0,01  | 0,2     | 8,2e-3 - 9,8e-3   | 96 - 97 %
+  *         0,1   | 0,2     | 5,8e-3 - 9,3e-3   | 71 - 75 %
+  * @param  pData a pointer on an initialized Filter_Kalman_Adaptive_Struct structure
+  * @param  value a input value
+  * @retval currentestimate a output value past the fast Kalman filtering
+  */
+float Filt_Kalm_Adaptive(Filter_Kalman_Adaptive_Struct *pData, float value)
+{
+  Filter_Kalman_Struct *pFilter = &pData->filter;
+  float errestimate = pFilter->errestimate;
+  float lastestimate = pFilter->lastestimate;
+  float kalmangain = pFilter->kalmangain;
+  float innovation = value - lastestimate;
+  float currentestimate;
+
+  if(pData->frozen && (fabsf(innovation) > pData->jump ||
+                       errestimate < pData->errlow || errestimate > pData->errhigh))
+  {
+    pData->frozen = 0;
+    pData->stable = 0;
+    pData->thaws++;
+  }
+
+  if(pData->frozen)
+  {
+    pData->fastcount++;
+  }
+  else
+  {
+    kalmangain = errestimate / (errestimate + pFilter->errmeasure);
+    Filt_Kalm_Adaptive_Check(pData, kalmangain);
+    pData->fullcount++;
+  }
+
+  currentestimate = lastestimate + kalmangain * innovation;
+  pFilter->errestimate = (1.0f - kalmangain) * errestimate +\
+                         fabsf(lastestimate - currentestimate) * pFilter->speed;
+  pFilter->lastestimate = currentestimate;
+  pFilter->kalmangain = kalmangain;
+  return currentestimate;
+}
+
+/**
+  * @brief  The function to filter a block of data with the fast Kalman filter
+  *         which freezes the converged Kalman Gain.
+  * @note   The result is bit-identical to calling Filt_Kalm_Adaptive() for
+  *         every sample of the block. The function supports in-place
+  *         filtering (in == out).
+  * @param  pData a pointer on an initialized Filter_Kalman_Adaptive_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  out a pointer on an array for output values
+  * @param  n a number of values in the arrays
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Adaptive_Block(Filter_Kalman_Adaptive_Struct *pData, const float *in, float *out,
+                                               size_t n)
+{
+  float errmeasure = pData->filter.errmeasure;
+  float errestimate = pData->filter.errestimate;
+  float speed = pData->filter.speed;
+  float lastestimate = pData->filter.lastestimate;
+  float kalmangain = pData->filter.kalmangain;
+  float jump = pData->jump;
+  uint32_t fastcount = 0;
+  float currentestimate;
+
+  for(size_t i = 0; i < n; i++)
+  {
+    float innovation = in[i] - lastestimate;
+    if(pData->frozen)
+    {
+      if(fabsf(innovation) > jump || errestimate < pData->errlow || errestimate > pData->errhigh)
+      {
+        pData->frozen = 0;
+        pData->stable = 0;
+        pData->thaws++;
+      }
+      else
+      {
+        fastcount++;
+      }
+    }
+    if(!pData->frozen)
+    {
+      kalmangain = errestimate / (errestimate + errmeasure);
+      Filt_Kalm_Adaptive_Check(pData, kalmangain);
+    }
+    currentestimate = lastestimate + kalmangain * innovation;
+    errestimate = (1.0f - kalmangain) * errestimate +\
+                  fabsf(lastestimate - currentestimate) * speed;
+    lastestimate = currentestimate;
+    out[i] = currentestimate;
+  }
+
+  pData->filter.errestimate = errestimate;
+  pData->filter.lastestimate = lastestimate;
+  pData->filter.kalmangain = kalmangain;
+  pData->fastcount += fastcount;
+  pData->fullcount += (uint32_t)n - fastcount;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to clear statistics of the fast Kalman filter which
+  *         freezes the converged Kalman Gain
+  * @note   The filter state and the frozen Gain are kept.
+  * @param  pData a pointer on an initialized Filter_Kalman_Adaptive_Struct structure
+  * @retval None
+  */
+void Filt_Kalm_Adaptive_Reset_Stats(Filter_Kalman_Adaptive_Struct *pData)
+{
+  pData->fullcount = 0;
+  pData->fastcount = 0;
+  pData->freezes = 0;
+  pData->thaws = 0;
+}
+
+/**
+  * @brief  The function to initial parameters for the fast Kalman filter
+  *         which rejects outliers, NaN and infinite samples
+  * @param  pData a pointer on a empty Filter_Kalman_Gated_Struct structure
+  * @param  ErrMeasure a predicted input date standard deviation
+  * @param  Speed a rate of change of output values (from 0,001 to 1)
+  * @param  Gate a sample is taken if its innovation |value - lastestimate|
+  *         is at most Gate * sqrt(errestimate + errmeasure) (> 0, for
+  *         example 3 - 5, INFINITY takes all finite samples)
+  * @param  Reacquire a number of successive outliers after which the next
+  *         finite sample restarts the filter (e.g. after a real step of the
+  *         input), 0 disables the restart
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Gated_Init(Filter_Kalman_Gated_Struct *pData, float ErrMeasure, float Speed,
+                                           float Gate, uint32_t Reacquire)
+{
+  if(!(Gate > 0.0f))
+  {
+    return NON_HAL_ERROR;
+  }
+  Filt_Kalm_Init(&pData->filter, ErrMeasure, Speed);
+  pData->gate2 = Gate * Gate;
+  pData->reacquire = (Reacquire != 0) ? Reacquire : UINT32_MAX;
+  pData->run = 0;
+  pData->primed = 0;
+  Filt_Kalm_Gated_Reset_Stats(pData);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to filter data with the fast Kalman filter which
+  *         rejects outliers, NaN and infinite samples.
+  * @note   The first finite value is returned unchanged and starts the
+  *         filter, so the gate is centred on the signal and not on 0 (NaN
+  *         and infinite values before it return 0). After it a sample is
+  *         taken if innovation^2 <= Gate^2 * (errestimate + errmeasure), so
+  *         there is no square root. A comparison with NaN is
+  *         false, so NaN and infinite samples are never taken and they can't
+  *         poison the error estimate. A rejected sample leaves the filter as
+  *         it is (kalmangain is 0) and the previous estimate is returned.
+  *         After Reacquire successive outliers the next finite sample is
+  *         taken as the estimate and the error estimate starts again from
+  *         errmeasure, as after Filt_Kalm_Init().
+  * @note   The sample is selected with masks instead of branches, so clean
+  *         data costs a multiplication and a comparison more than Filt_Kalm().
+  * @param  pData a pointer on an initialized Filter_Kalman_Gated_Struct structure
+  * @param  value a input value
+  * @retval currentestimate a output value past the fast Kalman filtering
+  */
+float Filt_Kalm_Gated(Filter_Kalman_Gated_Struct *pData, float value)
+{
+  Filter_Kalman_Struct *pFilter = &pData->filter;
+  float errmeasure = pFilter->errmeasure;
+  float errestimate = pFilter->errestimate;
+  float lastestimate = pFilter->lastestimate;
+  float innovation = value - lastestimate;
+  uint32_t finite = fabsf(value) <= FLT_MAX;
+  uint32_t seed = finite & !pData->primed;
+  uint32_t accept = finite & !seed & (innovation * innovation <= pData->gate2 * (errestimate + errmeasure));
+  uint32_t restart = finite & !accept & (seed | (pData->run >= pData->reacquire));
+  float kalmangain = accept ? errestimate / (errestimate + errmeasure) : 0.0f;
+  float currentestimate;
+
+  innovation = accept ? innovation : 0.0f;
+  currentestimate = lastestimate + kalmangain * innovation;
+  errestimate = (1.0f - kalmangain) * errestimate +\
+                fabsf(lastestimate - currentestimate) * pFilter->speed;
+  currentestimate = restart ? value : currentestimate;
+  pFilter->errestimate = restart ? errmeasure : errestimate;
+  pFilter->lastestimate = currentestimate;
+  pFilter->kalmangain = kalmangain;
+
+  pData->run = (accept | restart) ? 0 : pData->run + finite;
+  pData->primed |= finite;
+  pData->accepted += accept | seed;
+  pData->rejected += finite & !accept & !restart;
+  pData->invalid += !finite;
+  pData->reacquired += restart & !seed;
+  return currentestimate;
+}
+
+/**
+  * @brief  The function to filter a block of data with the fast Kalman filter
+  *         which rejects outliers, NaN and infinite samples.
+  * @note   The result is bit-identical to calling Filt_Kalm_Gated() for
+  *         every sample of the block. The function supports in-place
+  *         filtering (in == out).
+  * @note   Time per sample of clean data (x86-64, gcc -O2, blocks of 1024):
+  *         Filt_Kalm_Block() 13,5 ns, Filt_Kalm_Gated_Block() 13,4 - 13,7 ns, the
+  *         division is the longest step of the chain in both of them.
+  * @param  pData a pointer on an initialized Filter_Kalman_Gated_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  out a pointer on an array for output values
+  * @param  n a number of values in the arrays
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Gated_Block(Filter_Kalman_Gated_Struct *pData, const float *in, float *out, size_t n)
+{
+  float errmeasure = pData->filter.errmeasure;
+  float errestimate = pData->filter.errestimate;
+  float speed = pData->filter.speed;
+  float lastestimate = pData->filter.lastestimate;
+  float kalmangain = pData->filter.kalmangain;
+  float gate2 = pData->gate2;
+  uint32_t reacquire = pData->reacquire;
+  uint32_t run = pData->run;
+  uint32_t primed = pData->primed;
+  uint32_t accepted = 0;
+  uint32_t rejected = 0;
+  uint32_t invalid = 0;
+  uint32_t reacquired = 0;
+
+  for(size_t i = 0; i < n; i++)
+  {
+    float value = in[i];
+    float innovation = value - lastestimate;
+    uint32_t finite = fabsf(value) <= FLT_MAX;
+    uint32_t seed = finite & !primed;
+    uint32_t accept = finite & !seed & (innovation * innovation <= gate2 * (errestimate + errmeasure));
+    uint32_t restart = finite & !accept & (seed | (run >= reacquire));
+    float currentestimate;
+
+    kalmangain = accept ? errestimate / (errestimate + errmeasure) : 0.0f;
+    innovation = accept ? innovation : 0.0f;
+    currentestimate = lastestimate + kalmangain * innovation;
+    errestimate = (1.0f - kalmangain) * errestimate +\
+                  fabsf(lastestimate - currentestimate) * speed;
+    lastestimate = restart ? value : currentestimate;
+    errestimate = restart ? errmeasure : errestimate;
+    out[i] = lastestimate;
+
+    run = (accept | restart) ? 0 : run + finite;
+    primed |= finite;
+    accepted += accept | seed;
+    rejected += finite & !accept & !restart;
+    invalid += !finite;
+    reacquired += restart & !seed;
+  }
+
+  pData->filter.errestimate = errestimate;
+  pData->filter.lastestimate = lastestimate;
+  pData->filter.kalmangain = kalmangain;
+  pData->run = run;
+  pData->primed = primed;
+  pData->accepted += accepted;
+  pData->rejected += rejected;
+  pData->invalid += invalid;
+  pData->reacquired += reacquired;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to clear counters of the fast Kalman filter which
+  *         rejects outliers, NaN and infinite samples
+  * @note   The filter state and the number of successive outliers are kept.
+  * @param  pData a pointer on an initialized Filter_Kalman_Gated_Struct structure
+  * @retval None
+  */
+void Filt_Kalm_Gated_Reset_Stats(Filter_Kalman_Gated_Struct *pData)
+{
+  pData->accepted = 0;
+  pData->rejected = 0;
+  pData->invalid = 0;
+  pData->reacquired = 0;
+}
+
+/**
+  * @brief  The function to initial parameters for the fast Kalman filter
+  *         which takes one decimated value per Factor input samples
+  * @note   The decimated value is a weighted mean of the samples, so its
+  *         noise is lower than the noise of a sample. The error measure of
+  *         the filter is ErrMeasure * sqrt(sum(w^2)) / sum(w) for the
+  *         weights w of the prefilter: ErrMeasure / sqrt(Factor) for
+  *         order 1 and ErrMeasure * sqrt((2 * Factor + 1) /
+  *         (3 * Factor * (Factor + 1))) for order 2.
+  * @param  pData a pointer on a empty Filter_Kalman_Decim_Struct structure
+  * @param  ErrMeasure a predicted input date standard deviation (of one
+  *         input sample)
+  * @param  Speed a rate of change of output values (from 0,001 to 1, per
+  *         output value)
+  * @param  Factor a number of input samples per output value (> 0)
+  * @param  Order an order of the CIC prefilter: 1 - a mean of Factor
+  *         samples, 2 - a triangle over 2 * Factor samples (stronger
+  *         suppression of the noise which is aliased by the decimation)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Decim_Init(Filter_Kalman_Decim_Struct *pData, float ErrMeasure, float Speed,
+                                           uint32_t Factor, uint32_t Order)
+{
+  float factor = (float)Factor;
+
+  if(Factor == 0 || (Order != 1 && Order != 2))
+  {
+    return NON_HAL_ERROR;
+  }
+  if(Order == 1)
+  {
+    Filt_Kalm_Init(&pData->filter, ErrMeasure / sqrtf(factor), Speed);
+    pData->scale = 1.0f / factor;
+  }
+  else
+  {
+    Filt_Kalm_Init(&pData->filter,
+                   ErrMeasure * sqrtf((2.0f * factor + 1.0f) / (3.0f * factor * (factor + 1.0f))), Speed);
+    pData->scale = 1.0f / (factor * (factor + 1.0f));
+  }
+  pData->sum = 0.0f;
+  pData->integral = 0.0f;
+  pData->lastpart = 0.0f;
+  pData->factor = Factor;
+  pData->order = Order;
+  pData->count = 0;
+  pData->primed = 0;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to compute the decimated value of the samples of an
+  *         output value
+  * @note   The second integrator is sum((Factor - i) * x[i]), so the
+  *         triangle (weights 1 ... Factor of the previous samples and
+  *         Factor ... 1 of the current ones) is the part of the previous
+  *         samples plus the second integrator. The previous samples of the
+  *         first output are taken equal to the current ones.
+  * @param  pData a pointer on an initialized Filter_Kalman_Decim_Struct structure
+  * @param  sum the first integrator (a sum of the samples)
+  * @param  integral the second integrator (a sum of sums of the samples)
+  * @retval the decimated value
+  */
+static float Filt_Kalm_Decim_Value(Filter_Kalman_Decim_Struct *pData, float sum, float integral)
+{
+  float value;
+  float part;
+
+  if(pData->order == 1)
+  {
+    value = sum * pData->scale;
+  }
+  else
+  {
+    part = (float)(pData->factor + 1U) * sum - integral;
+    if(!pData->primed)
+    {
+      pData->lastpart = part;
+    }
+    value = (pData->lastpart + integral) * pData->scale;
+    pData->lastpart = part;
+  }
+  pData->primed = 1;
+  return value;
+}
+
+/**
+  * @brief  The function to filter data with the fast Kalman filter which
+  *         takes one decimated value per Factor input samples.
+  * @note   An input sample costs two additions (the integrators of the CIC
+  *         prefilter), the Kalman update (with the division) is made once
+  *         per output value, so the output rate is the input rate / Factor.
+  * @param  pData a pointer on an initialized Filter_Kalman_Decim_Struct structure
+  * @param  value a input value
+  * @param  out a pointer on a output value past the fast Kalman filtering,
+  *         it is written only if the function returns 1
+  * @retval 1 if an output value is written to out, 0 otherwise
+  */
+uint32_t Filt_Kalm_Decim(Filter_Kalman_Decim_Struct *pData, float value, float *out)
+{
+  pData->sum += value;
+  pData->integral += pData->sum;
+  if(++pData->count < pData->factor)
+  {
+    return 0;
+  }
+  *out = Filt_Kalm(&pData->filter, Filt_Kalm_Decim_Value(pData, pData->sum, pData->integral));
+  pData->sum = 0.0f;
+  pData->integral = 0.0f;
+  pData->count = 0;
+  return 1;
+}
+
+/**
+  * @brief  The function to filter a block of data with the fast Kalman filter
+  *         which takes one decimated value per Factor input samples.
+  * @note   The result is bit-identical to calling Filt_Kalm_Decim() for
+  *         every sample of the block. Samples of an unfinished output value
+  *         are kept for the next call, so a block may have any length.
+  * @note   Time per input sample (x86-64, gcc -O2, blocks of 1000):
+  *         Filt_Kalm_Block() 12,6 ns; Filt_Kalm_Decim_Block() with Factor
+  *         10 - 2,0 ns, 100 - 0,9 ns, 1000 - 0,9 ns (the chain of additions
+  *         of the integrators).
+  * @param  pData a pointer on an initialized Filter_Kalman_Decim_Struct structure
+  * @param  in a pointer on an array of input values
+  * @param  n a number of input values
+  * @param  out a pointer on an array for output values, it must have space
+  *         for FILT_KALM_DECIM_OUT_SIZE(n, Factor) values
+  * @param  length a pointer on a number of written output values
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Decim_Block(Filter_Kalman_Decim_Struct *pData, const float *in, size_t n,
+                                            float *out, size_t *length)
+{
+  float sum = pData->sum;
+  float integral = pData->integral;
+  uint32_t factor = pData->factor;
+  uint32_t count = pData->count;
+  size_t written = 0;
+  size_t i = 0;
+
+  while(i < n)
+  {
+    // the samples of the current output value are summed without a check per sample
+    size_t chunk = factor - count;
+    if(chunk > n - i)
+    {
+      chunk = n - i;
+    }
+    for(size_t j = 0; j < chunk; j++)
+    {
+      sum += in[i + j];
+      integral += sum;
+    }
+    i += chunk;
+    count += (uint32_t)chunk;
+    if(count == factor)
+    {
+      out[written++] = Filt_Kalm(&pData->filter, Filt_Kalm_Decim_Value(pData, sum, integral));
+      sum = 0.0f;
+      integral = 0.0f;
+      count = 0;
+    }
+  }
+
+  pData->sum = sum;
+  pData->integral = integral;
+  pData->count = count;
+  *length = written;
+  return NON_HAL_OK;
+}
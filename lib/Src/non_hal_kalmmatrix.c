@@ -0,0 +1,435 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_kalmmatrix.c
+  * @brief      This file provides functions of the linear Kalman filter with
+  *             a state vector and a measurement vector.
+  *
+  *             The filter is:
+  *               - predict: x = F * x, P = F * P * F' + Q;
+  *               - update:  S = H * P * H' + R, K = P * H' * S^-1,
+  *                          x = x + K * (z - H * x),
+  *                          P = (I - K * H) * P * (I - K * H)' + K * R * K'.
+  *
+  *             The covariance is updated in the Joseph form, so it stays
+  *             positive definite with float rounding, and it is made exactly
+  *             symmetric after every update. S is
+  *             inverted with the Cholesky decomposition. All matrices are
+  *             in the work buffer of the caller (no malloc). The kernels are
+  *             inlined with constant sizes for common models (2, 3, 4, 6 and
+  *             9 states), so the compiler unrolls their loops
+  *             (FILT_KALM_MATRIX_UNROLL).
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_lib.h"
+#include <math.h>
+#include <string.h>
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief Set FILT_KALM_MATRIX_UNROLL to 0 to save flash: all sizes use
+  *        the generic kernels then
+  */
+#ifndef FILT_KALM_MATRIX_UNROLL
+#define FILT_KALM_MATRIX_UNROLL   1
+#endif
+
+/** @brief Kernels with constant sizes are always inlined to be unrolled
+  */
+#if defined(__GNUC__)
+#define FILT_KALM_MATRIX_INLINE   static inline __attribute__((always_inline))
+#else
+#define FILT_KALM_MATRIX_INLINE   static inline
+#endif
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function to multiply matrices: C = A * B
+  * @param  C a pointer on the result (r x c)
+  * @param  A a pointer on the first matrix (r x k)
+  * @param  B a pointer on the second matrix (k x c)
+  * @param  r a number of rows of A
+  * @param  k a number of columns of A
+  * @param  c a number of columns of B
+  * @retval None
+  */
+FILT_KALM_MATRIX_INLINE void Filt_Kalm_Matrix_Mul(float *C, const float *A, const float *B,
+                                                  uint32_t r, uint32_t k, uint32_t c)
+{
+  for(uint32_t i = 0; i < r; i++)
+  {
+    for(uint32_t j = 0; j < c; j++)
+    {
+      float sum = 0.0f;
+      for(uint32_t l = 0; l < k; l++)
+      {
+        sum += A[i * k + l] * B[l * c + j];
+      }
+      C[i * c + j] = sum;
+    }
+  }
+}
+
+/**
+  * @brief  The function to multiply a matrix by a transposed matrix: C = A * B'
+  * @param  C a pointer on the result (r x c)
+  * @param  A a pointer on the first matrix (r x k)
+  * @param  B a pointer on the second matrix (c x k)
+  * @param  r a number of rows of A
+  * @param  k a number of columns of A
+  * @param  c a number of rows of B
+  * @retval None
+  */
+FILT_KALM_MATRIX_INLINE void Filt_Kalm_Matrix_Mul_T(float *C, const float *A, const float *B,
+                                                    uint32_t r, uint32_t k, uint32_t c)
+{
+  for(uint32_t i = 0; i < r; i++)
+  {
+    for(uint32_t j = 0; j < c; j++)
+    {
+      float sum = 0.0f;
+      for(uint32_t l = 0; l < k; l++)
+      {
+        sum += A[i * k + l] * B[j * k + l];
+      }
+      C[i * c + j] = sum;
+    }
+  }
+}
+
+/**
+  * @brief  The function to decompose a symmetric matrix: S = L * L'
+  * @note   L is written to the lower triangle of S, the diagonal keeps
+  *         the inverse values 1 / L[j][j].
+  * @param  S a pointer on a symmetric matrix (m x m)
+  * @param  m a number of rows of S
+  * @retval NON_HAL_ERROR if S isn't positive definite
+  */
+FILT_KALM_MATRIX_INLINE NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Cholesky(float *S, uint32_t m)
+{
+  for(uint32_t j = 0; j < m; j++)
+  {
+    float diag = S[j * m + j];
+    for(uint32_t k = 0; k < j; k++)
+    {
+      diag -= S[j * m + k] * S[j * m + k];
+    }
+    if(!(diag > 0.0f))
+    {
+      return NON_HAL_ERROR;
+    }
+    diag = 1.0f / sqrtf(diag);
+    S[j * m + j] = diag;
+    for(uint32_t i = j + 1; i < m; i++)
+    {
+      float sum = S[i * m + j];
+      for(uint32_t k = 0; k < j; k++)
+      {
+        sum -= S[i * m + k] * S[j * m + k];
+      }
+      S[i * m + j] = sum * diag;
+    }
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to solve L * L' * b' = b' with the result of
+  *         Filt_Kalm_Matrix_Cholesky
+  * @param  L a pointer on the decomposed matrix (m x m)
+  * @param  b a pointer on a row, it is replaced by the solution
+  * @param  m a number of rows of L
+  * @retval None
+  */
+FILT_KALM_MATRIX_INLINE void Filt_Kalm_Matrix_Solve(const float *L, float *b, uint32_t m)
+{
+  for(uint32_t i = 0; i < m; i++)
+  {
+    float sum = b[i];
+    for(uint32_t k = 0; k < i; k++)
+    {
+      sum -= L[i * m + k] * b[k];
+    }
+    b[i] = sum * L[i * m + i];
+  }
+  for(uint32_t i = m; i-- > 0;)
+  {
+    float sum = b[i];
+    for(uint32_t k = i + 1; k < m; k++)
+    {
+      sum -= L[k * m + i] * b[k];
+    }
+    b[i] = sum * L[i * m + i];
+  }
+}
+
+/**
+  * @brief  The predict step with constant sizes
+  * @param  pData a pointer on an initialized Filter_Kalman_Matrix_Struct structure
+  * @param  n a number of values of the state
+  * @retval None
+  */
+FILT_KALM_MATRIX_INLINE void Filt_Kalm_Matrix_Predict_N(Filter_Kalman_Matrix_Struct *pData, uint32_t n)
+{
+  float *T = pData->work;
+  float *v = T + n * n;
+
+  Filt_Kalm_Matrix_Mul(v, pData->F, pData->x, n, n, 1);
+  memcpy(pData->x, v, n * sizeof(float));
+  Filt_Kalm_Matrix_Mul(T, pData->F, pData->P, n, n, n);
+  Filt_Kalm_Matrix_Mul_T(pData->P, T, pData->F, n, n, n);
+  for(uint32_t i = 0; i < n * n; i++)
+  {
+    pData->P[i] += pData->Q[i];
+  }
+}
+
+/**
+  * @brief  The update step with constant sizes
+  * @param  pData a pointer on an initialized Filter_Kalman_Matrix_Struct structure
+  * @param  z a pointer on a measurement (m values)
+  * @param  n a number of values of the state
+  * @param  m a number of values of a measurement
+  * @retval NON_HAL_ERROR if H * P * H' + R isn't positive definite
+  */
+FILT_KALM_MATRIX_INLINE NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Update_NM(Filter_Kalman_Matrix_Struct *pData,
+                                                                         const float *z, uint32_t n, uint32_t m)
+{
+  float *y = pData->work;
+  float *S = y + m;
+  float *PHt = S + m * m;
+  float *K = PHt + n * m;
+  float *A = K + n * m;
+  float *T = A + n * n;
+
+  // the innovation y = z - H * x and its covariance S = H * P * H' + R
+  Filt_Kalm_Matrix_Mul(y, pData->H, pData->x, m, n, 1);
+  for(uint32_t i = 0; i < m; i++)
+  {
+    y[i] = z[i] - y[i];
+  }
+  Filt_Kalm_Matrix_Mul_T(PHt, pData->P, pData->H, n, n, m);
+  Filt_Kalm_Matrix_Mul(S, pData->H, PHt, m, n, m);
+  for(uint32_t i = 0; i < m * m; i++)
+  {
+    S[i] += pData->R[i];
+  }
+  if(Filt_Kalm_Matrix_Cholesky(S, m) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+
+  // K = P * H' * S^-1, each row of K solves S * k' = (P * H')' (S is symmetric)
+  memcpy(K, PHt, n * m * sizeof(float));
+  for(uint32_t i = 0; i < n; i++)
+  {
+    Filt_Kalm_Matrix_Solve(S, &K[i * m], m);
+  }
+  for(uint32_t i = 0; i < n; i++)
+  {
+    float sum = 0.0f;
+    for(uint32_t j = 0; j < m; j++)
+    {
+      sum += K[i * m + j] * y[j];
+    }
+    pData->x[i] += sum;
+  }
+
+  // the Joseph form: P = A * P * A' + K * R * K', A = I - K * H
+  Filt_Kalm_Matrix_Mul(A, K, pData->H, n, m, n);
+  for(uint32_t i = 0; i < n * n; i++)
+  {
+    A[i] = -A[i];
+  }
+  for(uint32_t i = 0; i < n; i++)
+  {
+    A[i * n + i] += 1.0f;
+  }
+  Filt_Kalm_Matrix_Mul(T, A, pData->P, n, n, n);
+  Filt_Kalm_Matrix_Mul_T(pData->P, T, A, n, n, n);
+  Filt_Kalm_Matrix_Mul(PHt, K, pData->R, n, m, m);
+  Filt_Kalm_Matrix_Mul_T(T, PHt, K, n, m, n);
+  for(uint32_t i = 0; i < n * n; i++)
+  {
+    pData->P[i] += T[i];
+  }
+  // A * P * A' is symmetric only up to the rounding, the upper triangle is
+  // the mirror of the lower one
+  for(uint32_t i = 1; i < n; i++)
+  {
+    for(uint32_t j = 0; j < i; j++)
+    {
+      pData->P[j * n + i] = pData->P[i * n + j];
+    }
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to initial the linear Kalman filter
+  * @note   The function sets x = 0, P = I, F = I, Q = 0, H = [I 0], R = I.
+  *         The model and the initial state are written to the matrices of
+  *         the structure after that.
+  * @param  pData a pointer on a empty Filter_Kalman_Matrix_Struct structure
+  * @param  pWork a pointer on a buffer of FILT_KALM_MATRIX_WORK_SIZE(states, measurements) floats
+  * @param  states a number of values of the state (from 1 to 9)
+  * @param  measurements a number of values of a measurement (from 1 to 9)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Init(Filter_Kalman_Matrix_Struct *pData, float *pWork,
+                                            uint32_t states, uint32_t measurements)
+{
+  uint32_t n = states;
+  uint32_t m = measurements;
+
+  if(pWork == NULL || n == 0 || n > FILT_KALM_MATRIX_MAX_SIZE || m == 0 || m > FILT_KALM_MATRIX_MAX_SIZE)
+  {
+    return NON_HAL_ERROR;
+  }
+  memset(pWork, 0, FILT_KALM_MATRIX_WORK_SIZE(n, m) * sizeof(float));
+  pData->states = n;
+  pData->measurements = m;
+  pData->x = pWork;
+  pData->P = pData->x + n;
+  pData->F = pData->P + n * n;
+  pData->Q = pData->F + n * n;
+  pData->H = pData->Q + n * n;
+  pData->R = pData->H + m * n;
+  pData->work = pData->R + m * m;
+  for(uint32_t i = 0; i < n; i++)
+  {
+    pData->P[i * n + i] = 1.0f;
+    pData->F[i * n + i] = 1.0f;
+  }
+  for(uint32_t i = 0; i < m; i++)
+  {
+    pData->R[i * m + i] = 1.0f;
+    if(i < n)
+    {
+      pData->H[i * n + i] = 1.0f;
+    }
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to predict the state of the linear Kalman filter
+  *         for the next step: x = F * x, P = F * P * F' + Q
+  * @param  pData a pointer on an initialized Filter_Kalman_Matrix_Struct structure
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Predict(Filter_Kalman_Matrix_Struct *pData)
+{
+#if FILT_KALM_MATRIX_UNROLL
+  switch(pData->states)
+  {
+    case 2:
+      Filt_Kalm_Matrix_Predict_N(pData, 2);
+      break;
+    case 3:
+      Filt_Kalm_Matrix_Predict_N(pData, 3);
+      break;
+    case 4:
+      Filt_Kalm_Matrix_Predict_N(pData, 4);
+      break;
+    case 6:
+      Filt_Kalm_Matrix_Predict_N(pData, 6);
+      break;
+    case 9:
+      Filt_Kalm_Matrix_Predict_N(pData, 9);
+      break;
+    default:
+      Filt_Kalm_Matrix_Predict_N(pData, pData->states);
+      break;
+  }
+#else
+  Filt_Kalm_Matrix_Predict_N(pData, pData->states);
+#endif
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to correct the state of the linear Kalman filter
+  *         with a measurement
+  * @note   If H * P * H' + R isn't positive definite (e.g. R = 0 and P is
+  *         singular), the function returns NON_HAL_ERROR and doesn't change
+  *         the state.
+  * @param  pData a pointer on an initialized Filter_Kalman_Matrix_Struct structure
+  * @param  z a pointer on a measurement (measurements values)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix_Update(Filter_Kalman_Matrix_Struct *pData, const float *z)
+{
+  uint32_t n = pData->states;
+  uint32_t m = pData->measurements;
+
+#if FILT_KALM_MATRIX_UNROLL
+  // common models: position/velocity, position/velocity/acceleration,
+  // 2D and 3D trackers, IMU fusion
+  if(n == 2 && m == 1)
+  {
+    return Filt_Kalm_Matrix_Update_NM(pData, z, 2, 1);
+  }
+  if(n == 3 && m == 1)
+  {
+    return Filt_Kalm_Matrix_Update_NM(pData, z, 3, 1);
+  }
+  if(n == 4 && m == 2)
+  {
+    return Filt_Kalm_Matrix_Update_NM(pData, z, 4, 2);
+  }
+  if(n == 6 && m == 3)
+  {
+    return Filt_Kalm_Matrix_Update_NM(pData, z, 6, 3);
+  }
+  if(n == 9 && m == 3)
+  {
+    return Filt_Kalm_Matrix_Update_NM(pData, z, 9, 3);
+  }
+#endif
+  return Filt_Kalm_Matrix_Update_NM(pData, z, n, m);
+}
+
+/**
+  * @brief  The function to filter a measurement with the linear Kalman filter
+  *         (the predict step and the update step)
+  * @param  pData a pointer on an initialized Filter_Kalman_Matrix_Struct structure
+  * @param  z a pointer on a measurement (measurements values)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Matrix(Filter_Kalman_Matrix_Struct *pData, const float *z)
+{
+  Filt_Kalm_Matrix_Predict(pData);
+  return Filt_Kalm_Matrix_Update(pData, z);
+}
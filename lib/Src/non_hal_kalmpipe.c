@@ -0,0 +1,366 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_kalmpipe.c
+  * @brief      This file provides functions to filter channels of data fed
+  *             by several threads of a POSIX host with the fast Kalman
+  *             filters on a pool of worker threads.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#if !defined(_GNU_SOURCE) && defined(__linux__)
+#define _GNU_SOURCE
+#endif
+#include "non_hal_lib.h"
+#include "non_hal_kalmpipe.h"
+#if NON_HAL_KALM_PIPE
+#include <sched.h>
+#include <time.h>
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function to filter all samples of the queue of a worker and
+  *         to pass results to the callback in batches
+  * @param  pWorker a pointer on a worker of a started pipeline
+  * @retval a number of filtered samples
+  */
+static uint32_t Filt_Kalm_Pipe_Drain(Filter_Kalman_Pipe_Worker *pWorker)
+{
+  Filter_Kalman_Pipe_Struct *pPipe = pWorker->pipe;
+  Filter_Kalman_Pipe_Cell *cells = pWorker->cells;
+  Filter_Kalman_Pipe_Sample *results = pWorker->results;
+  size_t mask = pPipe->depth - 1U;
+  size_t tail = pWorker->tail;
+  uint32_t count = 0;
+  uint32_t total = 0;
+
+  for(;;)
+  {
+    Filter_Kalman_Pipe_Cell *cell = &cells[tail & mask];
+    Filter_Kalman_Pipe_Sample sample;
+    if(atomic_load_explicit(&cell->sequence, memory_order_acquire) != tail + 1U)
+    {
+      break;
+    }
+    sample = cell->sample;
+    atomic_store_explicit(&cell->sequence, tail + pPipe->depth, memory_order_release);
+    tail++;
+
+    results[count].channel = sample.channel;
+    results[count].value = Filt_Kalm(&pPipe->filters[sample.channel], sample.value);
+    if(++count == pPipe->batch)
+    {
+      pPipe->callback(pPipe->context, pWorker->index, results, count);
+      pWorker->batches++;
+      total += count;
+      count = 0;
+    }
+  }
+  if(count != 0)
+  {
+    pPipe->callback(pPipe->context, pWorker->index, results, count);
+    pWorker->batches++;
+    total += count;
+  }
+
+  pWorker->tail = tail;
+  pWorker->processed += total;
+  return total;
+}
+
+/**
+  * @brief  The function of a worker thread
+  * @note   An idle worker yields the CPU FILT_KALM_PIPE_SPIN times and then
+  *         sleeps for FILT_KALM_PIPE_IDLE_NS between polls of its queue.
+  *         After the pipeline is stopped the worker filters the rest of its
+  *         queue and exits.
+  * @param  arg a pointer on the Filter_Kalman_Pipe_Worker structure
+  * @retval NULL
+  */
+static void *Filt_Kalm_Pipe_Run(void *arg)
+{
+  Filter_Kalman_Pipe_Worker *pWorker = arg;
+  const struct timespec idle = {0, FILT_KALM_PIPE_IDLE_NS};
+  uint32_t spins = 0;
+
+  for(;;)
+  {
+    if(Filt_Kalm_Pipe_Drain(pWorker) != 0)
+    {
+      spins = 0;
+      continue;
+    }
+    if(!atomic_load_explicit(&pWorker->pipe->running, memory_order_acquire))
+    {
+      Filt_Kalm_Pipe_Drain(pWorker);
+      break;
+    }
+    if(spins < FILT_KALM_PIPE_SPIN)
+    {
+      spins++;
+      sched_yield();
+    }
+    else
+    {
+      nanosleep(&idle, NULL);
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief  The function to initial parameters for the pipeline of the fast
+  *         Kalman filters
+  * @note   Channels are split into contiguous ranges, one range per worker,
+  *         so a filter is used by one thread only and filters of different
+  *         workers share no cache lines (except at the ends of the ranges).
+  *         If there are fewer channels than workers, extra workers aren't
+  *         used.
+  * @param  pPipe a pointer on a empty Filter_Kalman_Pipe_Struct structure
+  *         aligned to FILT_KALM_PIPE_LINE bytes (not from malloc())
+  * @param  pFilters a pointer on an array of channels filters initialized
+  *         with Filt_Kalm_Init()
+  * @param  channels a number of channels
+  * @param  workers a number of workers (from 1 to FILT_KALM_PIPE_MAX_WORKERS)
+  * @param  pCells a pointer on a buffer of
+  *         FILT_KALM_PIPE_CELLS_SIZE(workers, depth) cells for queues
+  * @param  depth a number of samples in a queue of a worker (a power of 2)
+  * @param  pResults a pointer on a buffer of
+  *         FILT_KALM_PIPE_RESULTS_SIZE(workers, batch) samples for results
+  * @param  batch a maximum number of results passed to the callback at once
+  * @param  callback a function which receives results
+  * @param  context a parameter for the callback
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Init(Filter_Kalman_Pipe_Struct *pPipe, Filter_Kalman_Struct *pFilters,
+                                          uint32_t channels, uint32_t workers,
+                                          Filter_Kalman_Pipe_Cell *pCells, uint32_t depth,
+                                          Filter_Kalman_Pipe_Sample *pResults, uint32_t batch,
+                                          Filter_Kalman_Pipe_Callback callback, void *context)
+{
+  if(pPipe == NULL || pFilters == NULL || pCells == NULL || pResults == NULL || callback == NULL ||
+     channels == 0 || workers == 0 || workers > FILT_KALM_PIPE_MAX_WORKERS ||
+     depth < 2U || (depth & (depth - 1U)) != 0 || batch == 0 ||
+     ((uintptr_t)pPipe & (_Alignof(Filter_Kalman_Pipe_Struct) - 1U)) != 0)
+  {
+    return NON_HAL_ERROR;
+  }
+
+  pPipe->filters = pFilters;
+  pPipe->channels = channels;
+  pPipe->range = (channels + workers - 1U) / workers;
+  pPipe->workers = (channels + pPipe->range - 1U) / pPipe->range;
+  pPipe->depth = depth;
+  pPipe->batch = batch;
+  pPipe->cpu = -1;
+  pPipe->callback = callback;
+  pPipe->context = context;
+  atomic_init(&pPipe->running, 0U);
+  atomic_init(&pPipe->dropped, 0UL);
+
+  for(uint32_t i = 0; i < pPipe->workers; i++)
+  {
+    Filter_Kalman_Pipe_Worker *pWorker = &pPipe->worker[i];
+    atomic_init(&pWorker->head, 0U);
+    pWorker->tail = 0;
+    pWorker->cells = &pCells[(size_t)i * depth];
+    pWorker->results = &pResults[(size_t)i * batch];
+    pWorker->pipe = pPipe;
+    pWorker->processed = 0;
+    pWorker->batches = 0;
+    pWorker->index = i;
+    for(uint32_t j = 0; j < depth; j++)
+    {
+      atomic_init(&pWorker->cells[j].sequence, (size_t)j);
+    }
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to start worker threads of the pipeline
+  * @note   On Linux the worker i is pinned to the CPU number (cpu + i) modulo
+  *         the number of CPUs the process may run on, counted among these
+  *         CPUs. The affinity is set before the thread is created, so the
+  *         worker never runs on another CPU. On other hosts cpu is ignored.
+  * @param  pPipe a pointer on an initialized Filter_Kalman_Pipe_Struct structure
+  * @param  cpu the CPU for the first worker, -1 to leave workers unpinned
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Start(Filter_Kalman_Pipe_Struct *pPipe, int32_t cpu)
+{
+#if defined(__linux__)
+  cpu_set_t allowed;
+  int cpus = 0;
+#endif
+
+  if(atomic_load(&pPipe->running))
+  {
+    return NON_HAL_ERROR;
+  }
+#if defined(__linux__)
+  if(cpu >= 0)
+  {
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || (cpus = CPU_COUNT(&allowed)) == 0)
+    {
+      return NON_HAL_ERROR;
+    }
+  }
+#endif
+  pPipe->cpu = cpu;
+  atomic_store(&pPipe->running, 1U);
+
+  for(uint32_t i = 0; i < pPipe->workers; i++)
+  {
+    Filter_Kalman_Pipe_Worker *pWorker = &pPipe->worker[i];
+    pthread_attr_t attr;
+    int error = pthread_attr_init(&attr);
+    if(error == 0)
+    {
+#if defined(__linux__)
+      if(cpu >= 0)
+      {
+        int skip = (int)(((uint32_t)cpu + i) % (uint32_t)cpus);
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for(int c = 0; c < CPU_SETSIZE; c++)
+        {
+          if(CPU_ISSET(c, &allowed) && skip-- == 0)
+          {
+            CPU_SET(c, &set);
+            break;
+          }
+        }
+        error = pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+      }
+#endif
+      if(error == 0)
+      {
+        error = pthread_create(&pWorker->thread, &attr, Filt_Kalm_Pipe_Run, pWorker);
+      }
+      pthread_attr_destroy(&attr);
+    }
+    if(error != 0)
+    {
+      atomic_store(&pPipe->running, 0U);
+      while(i-- > 0)
+      {
+        pthread_join(pPipe->worker[i].thread, NULL);
+      }
+      return NON_HAL_ERROR;
+    }
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to push a sample of a channel to the pipeline
+  * @note   The function is lock-free and it may be called by any number of
+  *         threads at once. Samples of a channel pushed by one thread are
+  *         filtered in the order they were pushed. Samples pushed before
+  *         Filt_Kalm_Pipe_Start() wait in the queue.
+  * @param  pPipe a pointer on an initialized Filter_Kalman_Pipe_Struct structure
+  * @param  channel a number of the channel
+  * @param  value a value
+  * @retval NON_HAL_ERROR if the channel is out of range or the queue of its
+  *         worker is full (the sample is counted in dropped), NON_HAL_OK
+  *         otherwise
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Push(Filter_Kalman_Pipe_Struct *pPipe, uint32_t channel, float value)
+{
+  Filter_Kalman_Pipe_Worker *pWorker;
+  Filter_Kalman_Pipe_Cell *cell;
+  size_t mask = pPipe->depth - 1U;
+  size_t head;
+
+  if(channel >= pPipe->channels)
+  {
+    return NON_HAL_ERROR;
+  }
+  pWorker = &pPipe->worker[channel / pPipe->range];
+
+  head = atomic_load_explicit(&pWorker->head, memory_order_relaxed);
+  for(;;)
+  {
+    ptrdiff_t diff;
+    cell = &pWorker->cells[head & mask];
+    diff = (ptrdiff_t)(atomic_load_explicit(&cell->sequence, memory_order_acquire) - head);
+    if(diff == 0)
+    {
+      if(atomic_compare_exchange_weak_explicit(&pWorker->head, &head, head + 1U,
+                                               memory_order_relaxed, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if(diff < 0)
+    {
+      atomic_fetch_add_explicit(&pPipe->dropped, 1UL, memory_order_relaxed);
+      return NON_HAL_ERROR;
+    }
+    else
+    {
+      head = atomic_load_explicit(&pWorker->head, memory_order_relaxed);
+    }
+  }
+
+  cell->sample.channel = channel;
+  cell->sample.value = value;
+  atomic_store_explicit(&cell->sequence, head + 1U, memory_order_release);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to stop worker threads of the pipeline
+  * @note   Workers filter all samples pushed before the call and exit. After
+  *         the function returns filters of channels may be read or changed
+  *         and the pipeline may be started again.
+  * @param  pPipe a pointer on a started Filter_Kalman_Pipe_Struct structure
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Filt_Kalm_Pipe_Stop(Filter_Kalman_Pipe_Struct *pPipe)
+{
+  if(!atomic_load(&pPipe->running))
+  {
+    return NON_HAL_ERROR;
+  }
+  atomic_store(&pPipe->running, 0U);
+  for(uint32_t i = 0; i < pPipe->workers; i++)
+  {
+    pthread_join(pPipe->worker[i].thread, NULL);
+  }
+  return NON_HAL_OK;
+}
+
+#endif /* NON_HAL_KALM_PIPE */
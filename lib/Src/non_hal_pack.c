@@ -0,0 +1,527 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_pack.c
+  * @brief      This file provides functions to pack readings to a compact
+  *             binary form instead of a text and to unpack them on a host.
+  *               - Packing:
+  *                 + uint32_t, uint64_t -> a varint (7 bits per byte)
+  *                 + int32_t, int64_t   -> a zigzag varint
+  *                 + int32_t series     -> zigzag varints of differences
+  *                 + float              -> a half-float (2 bytes)
+  *               - Unpacking: the same formats back
+  * @note       A varint stores 7 bits in each byte, the low bits first, the top
+  *             bit of a byte is set if more bytes follow. A zigzag maps signed
+  *             values to unsigned ones (0, -1, 1, -2 -> 0, 1, 2, 3), so small
+  *             negative values are short too. Half-floats are little endian.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_lib.h"
+#include <string.h>
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief Half-floats are converted by the FPU if it supports them
+  *        (e.g. Cortex-M4/M7 with -mfp16-format=ieee)
+  */
+#if defined(__ARM_FP16_FORMAT_IEEE) && defined(__ARM_FP) && (__ARM_FP & 0x2)
+#define NON_HAL_PACK_USE_FP16
+#endif
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function to map an int32_t value to an uint32_t value
+  *         (0, -1, 1, -2 -> 0, 1, 2, 3)
+  * @param  data an int32_t value
+  * @retval a zigzag value
+  */
+static inline uint32_t Non_HAL_Pack_Zigzag_32bit(int32_t data)
+{
+  return ((uint32_t)data << 1) ^ (0U - ((uint32_t)data >> 31));
+}
+
+/**
+  * @brief  The function to map an int64_t value to an uint64_t value
+  *         (0, -1, 1, -2 -> 0, 1, 2, 3)
+  * @param  data an int64_t value
+  * @retval a zigzag value
+  */
+static inline uint64_t Non_HAL_Pack_Zigzag_64bit(int64_t data)
+{
+  return ((uint64_t)data << 1) ^ (0U - ((uint64_t)data >> 63));
+}
+
+/**
+  * @brief  The function to count bytes of a varint
+  * @param  data an uint32_t value
+  * @retval a number of bytes (from 1 to 5)
+  */
+static inline uint32_t Non_HAL_Pack_Varint_Size_32bit(uint32_t data)
+{
+  return (32U - (uint32_t)__builtin_clz(data | 1U) + 6U) / 7U;
+}
+
+/**
+  * @brief  The function to write a varint
+  * @param  data an uint64_t value
+  * @param  buf a pointer on a buffer, it must have space for the varint
+  * @retval a number of written bytes
+  */
+static inline uint32_t Non_HAL_Pack_Put_Varint(uint64_t data, uint8_t *buf)
+{
+  uint32_t length = 0;
+  while(data >= 0x80U)
+  {
+    buf[length++] = (uint8_t)data | 0x80U;
+    data >>= 7;
+  }
+  buf[length++] = (uint8_t)data;
+  return length;
+}
+
+/**
+  * @brief  The function to read a varint
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer
+  * @param  maxsize a maximum number of bytes of the varint (5 or 10)
+  * @param  data_out a pointer on an uint64_t output value
+  * @param  length a pointer on a number of read bytes
+  * @retval NON_HAL_ERROR if the buffer ends or the varint is too long
+  */
+static NON_HAL_StatusTypeDef Non_HAL_Pack_Get_Varint(const uint8_t *buf, uint32_t sizebuf, uint32_t maxsize,
+                                                     uint64_t *data_out, uint32_t *length)
+{
+  uint64_t data = 0;
+  uint32_t limit = (sizebuf < maxsize) ? sizebuf : maxsize;
+  for(uint32_t i = 0; i < limit; i++)
+  {
+    data |= (uint64_t)(buf[i] & 0x7FU) << (7 * i);
+    if((buf[i] & 0x80U) == 0)
+    {
+      *data_out = data;
+      *length = i + 1;
+      return NON_HAL_OK;
+    }
+  }
+  *length = 0;
+  return NON_HAL_ERROR;
+}
+
+/**
+  * @brief  The function to pack an uint32_t value to a varint
+  * @param  data an uint32_t value
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer (5 bytes are always enough)
+  * @param  length a pointer on a number of written bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Pack_UInt_32bit(uint32_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length)
+{
+  if(sizebuf < Non_HAL_Pack_Varint_Size_32bit(data))
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = Non_HAL_Pack_Put_Varint(data, buf);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to pack an int32_t value to a zigzag varint
+  * @param  data an int32_t value
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer (5 bytes are always enough)
+  * @param  length a pointer on a number of written bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Pack_Int_32bit(int32_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length)
+{
+  return Non_HAL_Pack_UInt_32bit(Non_HAL_Pack_Zigzag_32bit(data), buf, sizebuf, length);
+}
+
+/**
+  * @brief  The function to pack an uint64_t value to a varint
+  * @param  data an uint64_t value
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer (10 bytes are always enough)
+  * @param  length a pointer on a number of written bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Pack_UInt_64bit(uint64_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length)
+{
+  uint32_t size = (64U - (uint32_t)__builtin_clzll(data | 1U) + 6U) / 7U;
+  if(sizebuf < size)
+  {
+    *length = 0;
+    return NON_HAL_ERROR;
+  }
+  *length = Non_HAL_Pack_Put_Varint(data, buf);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to pack an int64_t value to a zigzag varint
+  * @param  data an int64_t value
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer (10 bytes are always enough)
+  * @param  length a pointer on a number of written bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Pack_Int_64bit(int64_t data, uint8_t *buf, uint32_t sizebuf, uint32_t *length)
+{
+  return Non_HAL_Pack_UInt_64bit(Non_HAL_Pack_Zigzag_64bit(data), buf, sizebuf, length);
+}
+
+/**
+  * @brief  The function to initial the delta packing (or unpacking) of a series
+  * @param  pDelta a pointer on a Non_HAL_Pack_Delta_Struct structure
+  * @param  initial a value before the first value of the series (e.g. 0 or
+  *         the first value sent in a header)
+  * @retval None
+  */
+void Non_HAL_Pack_Delta_Init(Non_HAL_Pack_Delta_Struct *pDelta, int32_t initial)
+{
+  pDelta->last = initial;
+}
+
+/**
+  * @brief  The function to pack values of a series as zigzag varints of
+  *         differences between neighbouring values
+  * @note   A slowly changing reading (e.g. an ADC value or a filtered
+  *         temperature in 0.01 degrees) takes 1-2 bytes per value instead of
+  *         4 bytes or 5-12 symbols of a text. Differences wrap around, so any
+  *         int32_t values are restored exactly.
+  * @note   If the buffer is too small, the function packs only the values
+  *         which fit, sets length and packed and returns NON_HAL_ERROR.
+  *         The next call continues from the last packed value.
+  * @param  pDelta a pointer on a Non_HAL_Pack_Delta_Struct structure
+  * @param  data a pointer on an array of values
+  * @param  count a number of values in the array
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer (NON_HAL_PACK_DELTA_SIZE(count) is always enough)
+  * @param  length a pointer on a number of written bytes
+  * @param  packed a pointer on a number of packed values
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Pack_Delta(Non_HAL_Pack_Delta_Struct *pDelta, const int32_t *data, uint32_t count,
+                                         uint8_t *buf, uint32_t sizebuf, uint32_t *length, uint32_t *packed)
+{
+  uint32_t last = (uint32_t)pDelta->last;
+  uint32_t position = 0;
+  uint32_t i = 0;
+  NON_HAL_StatusTypeDef status = NON_HAL_OK;
+
+  for(; i < count; i++)
+  {
+    uint32_t value = Non_HAL_Pack_Zigzag_32bit((int32_t)((uint32_t)data[i] - last));
+    // the size is checked only near the end of the buffer
+    if(sizebuf - position < NON_HAL_PACK_MAX_SIZE_32BIT && sizebuf - position < Non_HAL_Pack_Varint_Size_32bit(value))
+    {
+      status = NON_HAL_ERROR;
+      break;
+    }
+    position += Non_HAL_Pack_Put_Varint(value, buf + position);
+    last = (uint32_t)data[i];
+  }
+  pDelta->last = (int32_t)last;
+  *length = position;
+  *packed = i;
+  return status;
+}
+
+/**
+  * @brief  The function to pack a float value to a half-float value
+  *         (IEEE 754 binary16: 1 sign bit, 5 bits of the exponent,
+  *         10 bits of the mantissa)
+  * @note   The value is rounded to nearest (ties to even). A half-float keeps
+  *         about 3 decimal digits, values above 65504 become inf, values
+  *         below 6.1e-5 become subnormal numbers or 0, nan stays nan.
+  * @param  data a float value
+  * @retval bits of the half-float value
+  */
+uint16_t Non_HAL_Pack_Half(float data)
+{
+#if defined(NON_HAL_PACK_USE_FP16)
+  __fp16 half = (__fp16)data;
+  uint16_t result;
+  memcpy(&result, &half, sizeof(result));
+  return result;
+#else
+  uint32_t bits;
+  memcpy(&bits, &data, sizeof(bits));
+  uint32_t sign = (bits >> 16) & 0x8000U;
+  uint32_t value = bits & 0x7FFFFFFFU;
+
+  if(value >= 0x7F800000U)
+  {
+    // inf, nan keeps the top bits of the payload and stays quiet
+    return (uint16_t)(sign | 0x7C00U | ((value > 0x7F800000U) ? 0x0200U | ((value >> 13) & 0x03FFU) : 0));
+  }
+  if(value >= 0x477FF000U)
+  {
+    // 65520 and above are rounded to inf
+    return (uint16_t)(sign | 0x7C00U);
+  }
+  if(value >= 0x38800000U)
+  {
+    // a normal number: rebias the exponent, round the 13 dropped bits to even
+    return (uint16_t)(sign | ((value - 0x38000000U + 0x0FFFU + ((value >> 13) & 1U)) >> 13));
+  }
+  uint32_t exponent = value >> 23;
+  if(exponent < 102U)
+  {
+    // less than 2^-25, a half of the smallest subnormal half-float
+    return (uint16_t)sign;
+  }
+  // a subnormal number: value * 2^24 rounded to even
+  uint32_t mantissa = (value & 0x007FFFFFU) | 0x00800000U;
+  uint32_t shift = 126U - exponent;
+  uint32_t result = mantissa >> shift;
+  uint32_t rest = mantissa & ((1U << shift) - 1U);
+  uint32_t half = 1U << (shift - 1U);
+  result += (rest > half || (rest == half && (result & 1U)));
+  return (uint16_t)(sign | result);
+#endif
+}
+
+/**
+  * @brief  The function to pack an array of float values to half-float values
+  *         (2 bytes per value, little endian)
+  * @param  data a pointer on an array of float values
+  * @param  count a number of values in the array
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer which must be least NON_HAL_PACK_HALF_SIZE(count)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Pack_Half_Block(const float *data, uint32_t count, uint8_t *buf, uint32_t sizebuf)
+{
+  if(sizebuf / 2U < count)
+  {
+    return NON_HAL_ERROR;
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint16_t half = Non_HAL_Pack_Half(data[i]);
+    buf[2 * i] = (uint8_t)half;
+    buf[2 * i + 1] = (uint8_t)(half >> 8);
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to unpack a varint to an uint32_t value
+  * @note   If the buffer ends before the last byte of the varint or the varint
+  *         is longer than 5 bytes, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. Bits above 32 are ignored.
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer
+  * @param  data_out a pointer on an uint32_t output value
+  * @param  length a pointer on a number of read bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Unpack_UInt_32bit(const uint8_t *buf, uint32_t sizebuf, uint32_t *data_out,
+                                                uint32_t *length)
+{
+  uint64_t data;
+  if(Non_HAL_Pack_Get_Varint(buf, sizebuf, NON_HAL_PACK_MAX_SIZE_32BIT, &data, length) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  *data_out = (uint32_t)data;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to unpack a zigzag varint to an int32_t value
+  * @note   Errors are the same as in Non_HAL_Unpack_UInt_32bit().
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer
+  * @param  data_out a pointer on an int32_t output value
+  * @param  length a pointer on a number of read bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Int_32bit(const uint8_t *buf, uint32_t sizebuf, int32_t *data_out,
+                                               uint32_t *length)
+{
+  uint32_t data;
+  if(Non_HAL_Unpack_UInt_32bit(buf, sizebuf, &data, length) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  *data_out = (int32_t)((data >> 1) ^ (0U - (data & 1U)));
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to unpack a varint to an uint64_t value
+  * @note   If the buffer ends before the last byte of the varint or the varint
+  *         is longer than 10 bytes, the function sets length to 0 and returns
+  *         NON_HAL_ERROR. Bits above 64 are ignored.
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer
+  * @param  data_out a pointer on an uint64_t output value
+  * @param  length a pointer on a number of read bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Unpack_UInt_64bit(const uint8_t *buf, uint32_t sizebuf, uint64_t *data_out,
+                                                uint32_t *length)
+{
+  return Non_HAL_Pack_Get_Varint(buf, sizebuf, NON_HAL_PACK_MAX_SIZE_64BIT, data_out, length);
+}
+
+/**
+  * @brief  The function to unpack a zigzag varint to an int64_t value
+  * @note   Errors are the same as in Non_HAL_Unpack_UInt_64bit().
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer
+  * @param  data_out a pointer on an int64_t output value
+  * @param  length a pointer on a number of read bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Int_64bit(const uint8_t *buf, uint32_t sizebuf, int64_t *data_out,
+                                               uint32_t *length)
+{
+  uint64_t data;
+  if(Non_HAL_Unpack_UInt_64bit(buf, sizebuf, &data, length) != NON_HAL_OK)
+  {
+    return NON_HAL_ERROR;
+  }
+  *data_out = (int64_t)((data >> 1) ^ (0U - (data & 1U)));
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to unpack count values of a series packed by
+  *         Non_HAL_Pack_Delta()
+  * @note   If the buffer ends before count values or a varint is broken, the
+  *         function unpacks the values before it, sets length and returns
+  *         NON_HAL_ERROR.
+  * @param  pDelta a pointer on a Non_HAL_Pack_Delta_Struct structure with
+  *         the same initial value as the packer
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer
+  * @param  data_out a pointer on an array for count values
+  * @param  count a number of values to unpack
+  * @param  length a pointer on a number of read bytes
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Delta(Non_HAL_Pack_Delta_Struct *pDelta, const uint8_t *buf, uint32_t sizebuf,
+                                           int32_t *data_out, uint32_t count, uint32_t *length)
+{
+  uint32_t last = (uint32_t)pDelta->last;
+  uint32_t position = 0;
+  NON_HAL_StatusTypeDef status = NON_HAL_OK;
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint32_t value;
+    uint32_t size;
+    if(Non_HAL_Unpack_UInt_32bit(buf + position, sizebuf - position, &value, &size) != NON_HAL_OK)
+    {
+      status = NON_HAL_ERROR;
+      break;
+    }
+    position += size;
+    last += (value >> 1) ^ (0U - (value & 1U));
+    data_out[i] = (int32_t)last;
+  }
+  pDelta->last = (int32_t)last;
+  *length = position;
+  return status;
+}
+
+/**
+  * @brief  The function to unpack a half-float value to a float value
+  *         (every half-float value is exact in float)
+  * @param  data bits of a half-float value
+  * @retval a float value
+  */
+float Non_HAL_Unpack_Half(uint16_t data)
+{
+#if defined(NON_HAL_PACK_USE_FP16)
+  __fp16 half;
+  memcpy(&half, &data, sizeof(half));
+  return (float)half;
+#else
+  uint32_t sign = (uint32_t)(data & 0x8000U) << 16;
+  uint32_t exponent = (data >> 10) & 0x1FU;
+  uint32_t mantissa = data & 0x03FFU;
+  uint32_t bits;
+  float result;
+
+  if(exponent == 0x1FU)
+  {
+    bits = sign | 0x7F800000U | (mantissa << 13);
+  }
+  else if(exponent != 0)
+  {
+    bits = sign | ((exponent + 112U) << 23) | (mantissa << 13);
+  }
+  else if(mantissa == 0)
+  {
+    bits = sign;
+  }
+  else
+  {
+    // a subnormal half-float is a normal float
+    uint32_t shift = (uint32_t)__builtin_clz(mantissa) - 21U;
+    mantissa <<= shift;
+    bits = sign | ((113U - shift) << 23) | ((mantissa & 0x03FFU) << 13);
+  }
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+#endif
+}
+
+/**
+  * @brief  The function to unpack an array of half-float values
+  *         (2 bytes per value, little endian) to float values
+  * @param  buf a pointer on a buffer
+  * @param  sizebuf a size of the buffer which must be least NON_HAL_PACK_HALF_SIZE(count)
+  * @param  data_out a pointer on an array for count values
+  * @param  count a number of values to unpack
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Unpack_Half_Block(const uint8_t *buf, uint32_t sizebuf, float *data_out, uint32_t count)
+{
+  if(sizebuf / 2U < count)
+  {
+    return NON_HAL_ERROR;
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    data_out[i] = Non_HAL_Unpack_Half((uint16_t)(buf[2 * i] | (buf[2 * i + 1] << 8)));
+  }
+  return NON_HAL_OK;
+}
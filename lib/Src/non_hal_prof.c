@@ -0,0 +1,242 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_prof.c
+  * @brief      This file provides functions to measure execution time of code
+  *             with named probes.
+  *
+  *             A probe collects a number of measurements, the shortest, the
+  *             longest and the mean duration and a log2 histogram. The same
+  *             instrumented code can be measured with:
+  *               - DWT   - the clock cycle counter of a Cortex-M core;
+  *               - TSC   - rdtsc of an x86 host;
+  *               - POSIX - clock_gettime(CLOCK_MONOTONIC) of other hosts;
+  *               - none  - NON_HAL_PROF_START/STOP are compiled out.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#if !defined(_POSIX_C_SOURCE) && (defined(__unix__) || defined(__APPLE__))
+#define _POSIX_C_SOURCE 199309L
+#endif
+#include "non_hal_lib.h"
+#include <string.h>
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_POSIX
+#include <time.h>
+#endif
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A size of a buffer for one line of the dump
+  */
+#define NON_HAL_PROF_LINE_SIZE   128U
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function to enable the time source of the backend
+  * @note   It enables the DWT unit and the CYCCNT counter on a Cortex-M core,
+  *         other backends don't need it.
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Prof_Enable(void)
+{
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_DWT
+  ENABLE_TIC_COUNTER();
+#endif
+  return NON_HAL_OK;
+}
+
+#if NON_HAL_PROF_BACKEND == NON_HAL_PROF_POSIX
+/**
+  * @brief  The function to read the monotonic clock of a POSIX host
+  * @retval the current time in nanoseconds
+  */
+uint64_t Non_HAL_Prof_Posix_Now(void)
+{
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000U + (uint64_t)time.tv_nsec;
+}
+#endif
+
+/**
+  * @brief  The function to initialize a probe
+  * @param  pProbe a pointer on a Non_HAL_Prof_Probe structure
+  * @param  name a name of the probe for the dump (the string isn't copied)
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Prof_Init(Non_HAL_Prof_Probe *pProbe, const char *name)
+{
+  if(pProbe == NULL)
+  {
+    return NON_HAL_ERROR;
+  }
+  pProbe->name = (name != NULL) ? name : "probe";
+  pProbe->start = 0;
+  Non_HAL_Prof_Reset(pProbe);
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to clear statistics of a probe
+  * @param  pProbe a pointer on an initialized Non_HAL_Prof_Probe structure
+  * @retval None
+  */
+void Non_HAL_Prof_Reset(Non_HAL_Prof_Probe *pProbe)
+{
+  pProbe->count = 0;
+  pProbe->min = UINT32_MAX;
+  pProbe->max = 0;
+  pProbe->sum = 0;
+  memset(pProbe->hist, 0, sizeof(pProbe->hist));
+}
+
+/**
+  * @brief  The function to add a duration to statistics of a probe
+  * @note   It is called by Non_HAL_Prof_Stop, it can also add durations
+  *         measured by other means.
+  * @param  pProbe a pointer on an initialized Non_HAL_Prof_Probe structure
+  * @param  ticks a duration in ticks of the backend
+  * @retval None
+  */
+void Non_HAL_Prof_Add(Non_HAL_Prof_Probe *pProbe, uint32_t ticks)
+{
+  uint32_t bin = (ticks != 0) ? 32U - (uint32_t)__builtin_clz(ticks) : 0;
+
+  pProbe->count++;
+  pProbe->sum += ticks;
+  if(ticks < pProbe->min)
+  {
+    pProbe->min = ticks;
+  }
+  if(ticks > pProbe->max)
+  {
+    pProbe->max = ticks;
+  }
+  pProbe->hist[(bin < NON_HAL_PROF_HIST_BINS) ? bin : NON_HAL_PROF_HIST_BINS - 1U]++;
+}
+
+/**
+  * @brief  The function to compute the mean duration of a probe
+  * @param  pProbe a pointer on an initialized Non_HAL_Prof_Probe structure
+  * @retval the mean duration in ticks (0 if there are no measurements)
+  */
+uint32_t Non_HAL_Prof_Mean(const Non_HAL_Prof_Probe *pProbe)
+{
+  if(pProbe->count == 0)
+  {
+    return 0;
+  }
+  return (uint32_t)(pProbe->sum / pProbe->count);
+}
+
+/**
+  * @brief  The function to append a label and a decimal value to a line
+  * @param  line a pointer on the end of the line
+  * @param  label a label before the value
+  * @param  value a value
+  * @retval a pointer on the new end of the line
+  */
+static uint8_t *Non_HAL_Prof_Put_Field(uint8_t *line, const char *label, uint32_t value)
+{
+  size_t length = strlen(label);
+  uint32_t digits;
+  memcpy(line, label, length);
+  line += length;
+  Non_HAL_CON_UInt_Array_to_DecString_32bit(&value, 1, ' ', line, 11, &digits);
+  return line + digits;
+}
+
+/**
+  * @brief  The function to write statistics of probes as text lines
+  * @note   example:
+  *         `filt_kalm: count=1000 min=41 mean=43 max=120 cycles`
+  *         `  [32..63] 990`
+  *         `  [64..127] 10`
+  *         Only non-empty bins of the histogram are written.
+  * @param  pProbes a pointer on an array of initialized Non_HAL_Prof_Probe structures
+  * @param  count a number of probes in the array
+  * @param  write a function to write each line
+  * @param  context a pointer which is passed to write
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Prof_Dump(const Non_HAL_Prof_Probe *pProbes, uint32_t count,
+                                        Non_HAL_Prof_Write_Callback write, void *context)
+{
+  uint8_t line[NON_HAL_PROF_LINE_SIZE];
+
+  if(write == NULL)
+  {
+    return NON_HAL_ERROR;
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    const Non_HAL_Prof_Probe *pProbe = &pProbes[i];
+    uint8_t *end = line;
+    size_t length = strlen(pProbe->name);
+
+    // long names are cut to keep the line in the buffer
+    length = (length < NON_HAL_PROF_LINE_SIZE / 4) ? length : NON_HAL_PROF_LINE_SIZE / 4;
+    memcpy(end, pProbe->name, length);
+    end += length;
+    end = Non_HAL_Prof_Put_Field(end, ": count=", pProbe->count);
+    end = Non_HAL_Prof_Put_Field(end, " min=", pProbe->count ? pProbe->min : 0);
+    end = Non_HAL_Prof_Put_Field(end, " mean=", Non_HAL_Prof_Mean(pProbe));
+    end = Non_HAL_Prof_Put_Field(end, " max=", pProbe->max);
+    memcpy(end, " " NON_HAL_PROF_UNIT "\n", sizeof(NON_HAL_PROF_UNIT) + 1);
+    end += sizeof(NON_HAL_PROF_UNIT) + 1;
+    write(context, line, (uint32_t)(end - line));
+
+    for(uint32_t bin = 0; bin < NON_HAL_PROF_HIST_BINS; bin++)
+    {
+      if(pProbe->hist[bin] == 0)
+      {
+        continue;
+      }
+      end = Non_HAL_Prof_Put_Field(line, "  [", (bin != 0) ? (uint32_t)(1ULL << (bin - 1U)) : 0);
+      if(bin == NON_HAL_PROF_HIST_BINS - 1U)
+      {
+        memcpy(end, "..]", 3);
+        end += 3;
+      }
+      else
+      {
+        end = Non_HAL_Prof_Put_Field(end, "..", (bin != 0) ? (uint32_t)((1ULL << bin) - 1U) : 0);
+        *end++ = ']';
+      }
+      end = Non_HAL_Prof_Put_Field(end, " ", pProbe->hist[bin]);
+      *end++ = '\n';
+      write(context, line, (uint32_t)(end - line));
+    }
+  }
+  return NON_HAL_OK;
+}
@@ -0,0 +1,402 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_stream.c
+  * @brief      This file provides a stream writer which formats numbers
+  *             directly into a linear or a ring buffer.
+  *
+  *             A converter gets a space in the buffer with
+  *             Non_HAL_Stream_Reserve and writes its symbols there, so a
+  *             telemetry line is built without intermediate copies. Only a
+  *             space which isn't contiguous at the end of the ring is taken
+  *             from the scratch buffer and copied. Waiting data is handed to
+  *             the flush callback when there are threshold bytes, the callback
+  *             can start UART DMA on the data in place and the DMA complete
+  *             interrupt releases the bytes with Non_HAL_Stream_Release.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "non_hal_lib.h"
+#include <string.h>
+
+/* Types ---------------------------------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+/* Constants -----------------------------------------------------------------*/
+/* Macros --------------------------------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function to get a position in the buffer of a counter
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  counter a value of a counter of the stream
+  * @retval a position in the buffer
+  */
+static inline uint32_t Non_HAL_Stream_Pos(const Non_HAL_Stream_Struct *pStream, uint32_t counter)
+{
+  return (pStream->mode == NON_HAL_STREAM_RING) ? (counter & (pStream->size - 1U)) : counter;
+}
+
+/**
+  * @brief  The function to start the linear buffer from the beginning when
+  *         all data is released (the output doesn't use it)
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @retval None
+  */
+static inline void Non_HAL_Stream_Rewind(Non_HAL_Stream_Struct *pStream)
+{
+  if(pStream->mode == NON_HAL_STREAM_LINEAR && pStream->tail == pStream->head)
+  {
+    pStream->head = 0;
+    pStream->flushed = 0;
+    pStream->tail = 0;
+  }
+}
+
+/**
+  * @brief  The function to copy data to the buffer with a wrap around
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  data a pointer on data
+  * @param  length a number of bytes
+  * @retval NON_HAL_ERROR if the data doesn't fit in the buffer
+  */
+static NON_HAL_StatusTypeDef Non_HAL_Stream_Copy(Non_HAL_Stream_Struct *pStream, const uint8_t *data, uint32_t length)
+{
+  uint32_t pos = Non_HAL_Stream_Pos(pStream, pStream->head);
+  uint32_t first = pStream->size - pos;
+
+  if(Non_HAL_Stream_Free(pStream) < length)
+  {
+    pStream->dropped++;
+    return NON_HAL_ERROR;
+  }
+  first = (length < first) ? length : first;
+  memcpy(&pStream->buffer[pos], data, first);
+  memcpy(pStream->buffer, data + first, length - first);
+  pStream->head += length;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to flush waiting data if there are threshold bytes
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @retval None
+  */
+static inline void Non_HAL_Stream_Auto_Flush(Non_HAL_Stream_Struct *pStream)
+{
+  if(pStream->threshold != 0 && pStream->head - pStream->flushed >= pStream->threshold)
+  {
+    Non_HAL_Stream_Flush(pStream);
+  }
+}
+
+/**
+  * @brief  The function to make free space for a write: it flushes waiting
+  *         data if the space is too small and the output is synchronous
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  length a number of bytes to write
+  * @retval None
+  */
+static void Non_HAL_Stream_Make_Space(Non_HAL_Stream_Struct *pStream, uint32_t length)
+{
+  Non_HAL_Stream_Rewind(pStream);
+  if(Non_HAL_Stream_Free(pStream) < length && pStream->flush != NULL)
+  {
+    Non_HAL_Stream_Flush(pStream);
+    Non_HAL_Stream_Rewind(pStream);
+  }
+}
+
+/**
+  * @brief  The function to initialize a stream writer
+  * @param  pStream a pointer on a Non_HAL_Stream_Struct structure
+  * @param  buffer a pointer on a buffer of the stream
+  * @param  size a size of the buffer (a power of two for NON_HAL_STREAM_RING)
+  * @param  mode a mode of the buffer
+  * @param  threshold a number of waiting bytes which starts a flush
+  *         (0 - only Non_HAL_Stream_Flush starts it)
+  * @param  flush a function to hand data to an output (it can be NULL)
+  * @param  context a pointer which is passed to the flush callback
+  * @retval NON_HAL_StatusTypeDef
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Init(Non_HAL_Stream_Struct *pStream, uint8_t *buffer, uint32_t size,
+                                          Non_HAL_Stream_Mode mode, uint32_t threshold,
+                                          Non_HAL_Stream_Flush_Callback flush, void *context)
+{
+  if(pStream == NULL || buffer == NULL || size == 0 || size > 0x80000000U)
+  {
+    return NON_HAL_ERROR;
+  }
+  if(mode == NON_HAL_STREAM_RING && (size & (size - 1U)) != 0)
+  {
+    return NON_HAL_ERROR;
+  }
+  pStream->buffer = buffer;
+  pStream->size = size;
+  pStream->mode = mode;
+  pStream->head = 0;
+  pStream->flushed = 0;
+  pStream->tail = 0;
+  pStream->threshold = threshold;
+  pStream->flush = flush;
+  pStream->context = context;
+  pStream->dropped = 0;
+  pStream->reserved = NULL;
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to get free space of a stream
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @retval a number of bytes which can be written
+  */
+uint32_t Non_HAL_Stream_Free(const Non_HAL_Stream_Struct *pStream)
+{
+  if(pStream->mode == NON_HAL_STREAM_RING)
+  {
+    return pStream->size - (pStream->head - pStream->tail);
+  }
+  return pStream->size - pStream->head;
+}
+
+/**
+  * @brief  The function to get a contiguous space for a converter
+  * @note   The space is in the buffer if it is contiguous there, otherwise it
+  *         is the scratch buffer of the stream. The converter writes up to
+  *         maxlength bytes there (with \0), then Non_HAL_Stream_Commit adds
+  *         the written bytes to the stream.
+  * @note   example: `p = Non_HAL_Stream_Reserve(&stream, 33);
+  *         Non_HAL_CON_Int_to_BinString_32bit(value, p, 33);
+  *         Non_HAL_Stream_Commit(&stream, 32);`
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  maxlength a maximum number of bytes which the converter writes
+  * @retval a pointer on the space or NULL if maxlength is too large
+  */
+uint8_t *Non_HAL_Stream_Reserve(Non_HAL_Stream_Struct *pStream, uint32_t maxlength)
+{
+  uint32_t pos;
+  uint32_t contiguous;
+
+  Non_HAL_Stream_Make_Space(pStream, maxlength);
+  pos = Non_HAL_Stream_Pos(pStream, pStream->head);
+  contiguous = Non_HAL_Stream_Free(pStream);
+  contiguous = (contiguous < pStream->size - pos) ? contiguous : pStream->size - pos;
+  if(contiguous >= maxlength)
+  {
+    pStream->reserved = &pStream->buffer[pos];
+  }
+  else if(maxlength <= NON_HAL_STREAM_SCRATCH_SIZE)
+  {
+    pStream->reserved = pStream->scratch;
+  }
+  else
+  {
+    pStream->reserved = NULL;
+  }
+  return pStream->reserved;
+}
+
+/**
+  * @brief  The function to add bytes written to a reserved space to a stream
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  length a number of written bytes (without \0)
+  * @retval NON_HAL_ERROR if there is no reserved space or the bytes don't fit
+  *         in the buffer (they are dropped)
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Commit(Non_HAL_Stream_Struct *pStream, uint32_t length)
+{
+  NON_HAL_StatusTypeDef status = NON_HAL_OK;
+
+  if(pStream->reserved == NULL)
+  {
+    pStream->dropped++;
+    return NON_HAL_ERROR;
+  }
+  if(pStream->reserved == pStream->scratch)
+  {
+    status = Non_HAL_Stream_Copy(pStream, pStream->scratch, length);
+  }
+  else
+  {
+    pStream->head += length;
+  }
+  pStream->reserved = NULL;
+  Non_HAL_Stream_Auto_Flush(pStream);
+  return status;
+}
+
+/**
+  * @brief  The function to write bytes to a stream
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  data a pointer on data
+  * @param  length a number of bytes
+  * @retval NON_HAL_ERROR if the bytes don't fit in the buffer (they are dropped)
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Write(Non_HAL_Stream_Struct *pStream, const uint8_t *data, uint32_t length)
+{
+  NON_HAL_StatusTypeDef status;
+
+  Non_HAL_Stream_Make_Space(pStream, length);
+  status = Non_HAL_Stream_Copy(pStream, data, length);
+  Non_HAL_Stream_Auto_Flush(pStream);
+  return status;
+}
+
+/**
+  * @brief  The function to write a symbol to a stream
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  symbol a symbol
+  * @retval NON_HAL_ERROR if the symbol doesn't fit in the buffer
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_Char(Non_HAL_Stream_Struct *pStream, uint8_t symbol)
+{
+  return Non_HAL_Stream_Write(pStream, &symbol, 1);
+}
+
+/**
+  * @brief  The function to write a null-terminated string to a stream
+  *         (without \0)
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  str a pointer on a null-terminated string
+  * @retval NON_HAL_ERROR if the string doesn't fit in the buffer
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_String(Non_HAL_Stream_Struct *pStream, const char *str)
+{
+  return Non_HAL_Stream_Write(pStream, (const uint8_t *)str, (uint32_t)strlen(str));
+}
+
+/**
+  * @brief  The function to write an uint32_t value with decimal symbols
+  *         (from 0 to 9) to a stream
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  data an uint32_t value
+  * @retval NON_HAL_ERROR if the symbols don't fit in the buffer
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_UInt_32bit(Non_HAL_Stream_Struct *pStream, uint32_t data)
+{
+  uint8_t *decstr = Non_HAL_Stream_Reserve(pStream, 11);
+  uint32_t length = 0;
+
+  if(decstr != NULL)
+  {
+    Non_HAL_CON_UInt_Array_to_DecString_32bit(&data, 1, 0, decstr, 11, &length);
+  }
+  return Non_HAL_Stream_Commit(pStream, length);
+}
+
+/**
+  * @brief  The function to write an int32_t value with decimal symbols
+  *         (from 0 to 9) to a stream
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  data an int32_t value
+  * @retval NON_HAL_ERROR if the symbols don't fit in the buffer
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_Int_32bit(Non_HAL_Stream_Struct *pStream, int32_t data)
+{
+  uint8_t *decstr = Non_HAL_Stream_Reserve(pStream, 12);
+  uint32_t length = 0;
+
+  if(decstr != NULL)
+  {
+    Non_HAL_CON_Int_Array_to_DecString_32bit(&data, 1, 0, decstr, 12, &length);
+  }
+  return Non_HAL_Stream_Commit(pStream, length);
+}
+
+/**
+  * @brief  The function to write a float value with the shortest decimal
+  *         string (see Non_HAL_CON_Float_to_DecString_Shortest) to a stream
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  data a float value
+  * @retval NON_HAL_ERROR if the symbols don't fit in the buffer
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Put_Float(Non_HAL_Stream_Struct *pStream, float data)
+{
+  uint8_t *decstr = Non_HAL_Stream_Reserve(pStream, 16);
+  uint32_t length = 0;
+
+  if(decstr != NULL)
+  {
+    Non_HAL_CON_Float_to_DecString_Shortest(data, decstr, 16);
+    length = (uint32_t)strlen((const char *)decstr);
+  }
+  return Non_HAL_Stream_Commit(pStream, length);
+}
+
+/**
+  * @brief  The function to hand waiting data of a stream to the flush callback
+  * @note   Only one part of data is in the output at a time: if the callback
+  *         returns 0 (e.g. it has started DMA), the next part is handed over
+  *         by the next flush after Non_HAL_Stream_Release. Data at the end of
+  *         the ring and at its beginning are handed over as two parts.
+  * @note   If the callback sends only a part of the data (it returns less
+  *         than length), the rest of the data waits and is handed over again
+  *         at once.
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @retval NON_HAL_ERROR if there is no flush callback
+  */
+NON_HAL_StatusTypeDef Non_HAL_Stream_Flush(Non_HAL_Stream_Struct *pStream)
+{
+  if(pStream->flush == NULL)
+  {
+    return NON_HAL_ERROR;
+  }
+  while(pStream->flushed == pStream->tail && pStream->head != pStream->flushed)
+  {
+    uint32_t start = pStream->flushed;
+    uint32_t pos = Non_HAL_Stream_Pos(pStream, start);
+    uint32_t length = pStream->head - start;
+    uint32_t sent;
+    length = (length < pStream->size - pos) ? length : pStream->size - pos;
+    // the whole part is in the output before the callback, an interrupt can release it
+    pStream->flushed = start + length;
+    sent = pStream->flush(pStream->context, &pStream->buffer[pos], length);
+    if(sent == 0)
+    {
+      break;
+    }
+    // a synchronous output has sent sent bytes, the rest of the part waits again
+    sent = (sent < length) ? sent : length;
+    pStream->flushed = start + sent;
+    Non_HAL_Stream_Release(pStream, sent);
+  }
+  return NON_HAL_OK;
+}
+
+/**
+  * @brief  The function to release bytes which the output has sent, their
+  *         space can be written again
+  * @note   It can be called from an interrupt (e.g. DMA transfer complete).
+  * @param  pStream a pointer on an initialized Non_HAL_Stream_Struct structure
+  * @param  length a number of sent bytes
+  * @retval None
+  */
+void Non_HAL_Stream_Release(Non_HAL_Stream_Struct *pStream, uint32_t length)
+{
+  pStream->tail += length;
+}
@@ -0,0 +1,133 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_test.h
+  * @brief      Helpers of the host tests of the Non HAL library: a check
+  *             counter, a pseudo-random generator, a timer and buffers of
+  *             an exact size for the address sanitizer.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+#ifndef NON_HAL_TEST_H_
+#define NON_HAL_TEST_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Variables -----------------------------------------------------------------*/
+
+/** @brief A number of failed checks of the test
+  */
+static uint64_t non_hal_test_failed = 0;
+
+/** @brief A state of the pseudo-random generator
+  */
+static uint64_t non_hal_test_seed = 88172645463325252ULL;
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of failed checks which are printed, others are only counted
+  */
+#define NON_HAL_TEST_PRINTED   20U
+
+/** @brief The check of a condition, a failed check is printed with the format
+  *        and arguments after the condition
+  */
+#define NON_HAL_TEST_CHECK(CONDITION, ...)                                     \
+  do                                                                           \
+  {                                                                            \
+    if(!(CONDITION))                                                           \
+    {                                                                          \
+      if(non_hal_test_failed++ < NON_HAL_TEST_PRINTED)                         \
+      {                                                                        \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__);                            \
+        printf(__VA_ARGS__);                                                   \
+        printf("\n");                                                          \
+      }                                                                        \
+    }                                                                          \
+  } while(0)
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function returns the next pseudo-random value (xorshift64)
+  * @retval a pseudo-random uint64_t value
+  */
+static inline uint64_t Non_HAL_Test_Random(void)
+{
+  non_hal_test_seed ^= non_hal_test_seed << 13;
+  non_hal_test_seed ^= non_hal_test_seed >> 7;
+  non_hal_test_seed ^= non_hal_test_seed << 17;
+  return non_hal_test_seed;
+}
+
+/**
+  * @brief  The function returns the time of the monotonic clock
+  * @retval the time in seconds
+  */
+static inline double Non_HAL_Test_Time(void)
+{
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+}
+
+/**
+  * @brief  The function allocates a buffer of exactly size bytes, so the
+  *         address sanitizer finds a write past the documented size of
+  *         a string
+  * @param  size a size of the buffer
+  * @retval a pointer on the buffer (the test stops if there is no memory)
+  */
+static inline uint8_t *Non_HAL_Test_Buffer(size_t size)
+{
+  uint8_t *buffer = malloc(size);
+  if(buffer == NULL)
+  {
+    printf("FAIL: no memory\n");
+    exit(EXIT_FAILURE);
+  }
+  return buffer;
+}
+
+/**
+  * @brief  The function prints a result of a part of the test
+  * @param  name a name of the part
+  * @param  checked a number of checked values
+  * @param  seconds the time of the part
+  * @retval None
+  */
+static inline void Non_HAL_Test_Report(const char *name, uint64_t checked, double seconds)
+{
+  printf("%-36s %12llu values %8.2f s, failed %llu\n", name, (unsigned long long)checked, seconds,
+         (unsigned long long)non_hal_test_failed);
+}
+
+#endif /* NON_HAL_TEST_H_ */
@@ -0,0 +1,816 @@
+/**
+  ******************************************************************************
+  * @file       test_conv.c
+  * @brief      The differential test of non_hal_conv.c: the converters are
+  *             compared with snprintf(), strtoul(), strtof() and strtod() of
+  *             the C library, and the throughput of both is printed.
+  *
+  *             Usage: test_conv [stride]
+  *             The 8-bit and 16-bit converters are checked with all values,
+  *             the 32-bit converters with every stride-th value of 2^32
+  *             (4099 by default, 1 for the exhaustive sweep). The strings
+  *             are written to buffers of the documented size, so the address
+  *             sanitizer finds a write past it.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_conv.h"
+#include "non_hal_test.h"
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of values of each part of the throughput report
+  */
+#define TEST_CONV_THROUGHPUT   (1U << 18)
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function returns a float value of bits
+  * @param  bits bits of a float value
+  * @retval the float value
+  */
+static float Test_Conv_Float(uint32_t bits)
+{
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/**
+  * @brief  The function returns bits of a float value
+  * @param  value a float value
+  * @retval bits of the value
+  */
+static uint32_t Test_Conv_Float_Bits(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+/**
+  * @brief  The function returns bits of a double value
+  * @param  value a double value
+  * @retval bits of the value
+  */
+static uint64_t Test_Conv_Double_Bits(double value)
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+/**
+  * @brief  The function writes a value as binary symbols, the most
+  *         significant bit first
+  * @param  data a value
+  * @param  bits a number of the low bits of the value to write
+  * @param  bitstr a pointer on a character string of bits + 1 bytes
+  * @retval None
+  */
+static void Test_Conv_Bin_Reference(uint64_t data, uint8_t bits, char *bitstr)
+{
+  for(uint8_t i = 0; i < bits; i++)
+  {
+    bitstr[i] = (char)('0' + ((data >> (bits - 1 - i)) & 1U));
+  }
+  bitstr[bits] = 0;
+}
+
+/**
+  * @brief  The function checks all values of the 8-bit and 16-bit converters
+  * @retval None
+  */
+static void Test_Conv_Small(void)
+{
+  double start = Non_HAL_Test_Time();
+  uint8_t *bin8 = Non_HAL_Test_Buffer(9);
+  uint8_t *bin16 = Non_HAL_Test_Buffer(17);
+  uint8_t *hex8 = Non_HAL_Test_Buffer(3);
+  uint8_t *hex16 = Non_HAL_Test_Buffer(5);
+  uint8_t *dec8 = Non_HAL_Test_Buffer(4);
+  uint8_t *sdec8 = Non_HAL_Test_Buffer(5);
+  char reference[32];
+
+  for(uint32_t value = 0; value < 256; value++)
+  {
+    snprintf(reference, sizeof(reference), "%" PRIu32, value);
+    NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_8bit((uint8_t)value, dec8, 4) == NON_HAL_OK
+                       && strcmp((char *)dec8, reference) == 0, "u8 %s: '%s'", reference, dec8);
+    snprintf(reference, sizeof(reference), "%d", (int8_t)value);
+    NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_DecString_8bit((int8_t)value, sdec8, 5) == NON_HAL_OK
+                       && strcmp((char *)sdec8, reference) == 0, "i8 %s: '%s'", reference, sdec8);
+
+    snprintf(reference, sizeof(reference), "%02" PRIX32, value);
+    NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_HexString_8bit((uint8_t)value, hex8, 3) == NON_HAL_OK
+                       && strcmp((char *)hex8, reference) == 0, "hex8 %s: '%s'", reference, hex8);
+    uint8_t hex_out = 0;
+    uint32_t length = 0;
+    NON_HAL_TEST_CHECK(Non_HAL_CON_HexString_to_UInt_8bit(hex8, 3, &hex_out, &length) == NON_HAL_OK
+                       && hex_out == value && length == 2, "hex8 %s: %u", reference, hex_out);
+
+    Test_Conv_Bin_Reference(value, 8, reference);
+    NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_BinString_8bit((int8_t)value, bin8, 9) == NON_HAL_OK
+                       && strcmp((char *)bin8, reference) == 0, "bin8 %s: '%s'", reference, bin8);
+    int8_t bin_out = 0;
+    NON_HAL_TEST_CHECK(Non_HAL_CON_BinString_to_Int_8bit(bin8, &bin_out) == NON_HAL_OK
+                       && bin_out == (int8_t)value, "bin8 %s: %d", reference, bin_out);
+  }
+
+  for(uint32_t value = 0; value < 65536; value++)
+  {
+    snprintf(reference, sizeof(reference), "%04" PRIX32, value);
+    NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_HexString_16bit((uint16_t)value, hex16, 5) == NON_HAL_OK
+                       && strcmp((char *)hex16, reference) == 0, "hex16 %s: '%s'", reference, hex16);
+    uint16_t hex_out = 0;
+    uint32_t length = 0;
+    NON_HAL_TEST_CHECK(Non_HAL_CON_HexString_to_UInt_16bit(hex16, 5, &hex_out, &length) == NON_HAL_OK
+                       && hex_out == value && length == 4, "hex16 %s: %u", reference, hex_out);
+
+    Test_Conv_Bin_Reference(value, 16, reference);
+    NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_BinString_16bit((int16_t)value, bin16, 17) == NON_HAL_OK
+                       && strcmp((char *)bin16, reference) == 0, "bin16 %s: '%s'", reference, bin16);
+    int16_t bin_out = 0;
+    NON_HAL_TEST_CHECK(Non_HAL_CON_BinString_to_Int_16bit(bin16, &bin_out) == NON_HAL_OK
+                       && bin_out == (int16_t)value, "bin16 %s: %d", reference, bin_out);
+  }
+
+  // the functions return an error for a buffer which is one byte too small
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_8bit(255, dec8, 3) == NON_HAL_ERROR, "u8 sizebuf 3");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_DecString_8bit(-128, sdec8, 4) == NON_HAL_ERROR, "i8 sizebuf 4");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_HexString_8bit(255, hex8, 2) == NON_HAL_ERROR, "hex8 sizebuf 2");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_BinString_8bit(-1, bin8, 8) == NON_HAL_ERROR, "bin8 sizebuf 8");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_BinString_to_Int_8bit((uint8_t *)"10120101", (int8_t[1]){0}) == NON_HAL_ERROR,
+                     "bin8 '2'");
+
+  free(bin8);
+  free(bin16);
+  free(hex8);
+  free(hex16);
+  free(dec8);
+  free(sdec8);
+  Non_HAL_Test_Report("8-bit and 16-bit, all values", 256 + 65536, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the 32-bit converters and parsers with one value
+  * @param  value a value
+  * @param  buffers buffers of the documented sizes: 11, 12, 9, 33, 11 and 12 bytes
+  * @retval None
+  */
+static void Test_Conv_32bit_Value(uint32_t value, uint8_t *buffers[6])
+{
+  char reference[40];
+  uint32_t length = 0;
+
+  snprintf(reference, sizeof(reference), "%" PRIu32, value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_32bit(value, buffers[0], 11) == NON_HAL_OK
+                     && strcmp((char *)buffers[0], reference) == 0, "u32 %s: '%s'", reference, buffers[0]);
+  uint32_t unsigned_out = 0;
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_UInt_32bit((uint8_t *)reference, 11, &unsigned_out, &length) == NON_HAL_OK
+                     && unsigned_out == strtoul(reference, NULL, 10) && length == strlen(reference),
+                     "parse u32 %s: %" PRIu32, reference, unsigned_out);
+
+  int32_t signed_value = (int32_t)value;
+  snprintf(reference, sizeof(reference), "%" PRId32, signed_value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_DecString_32bit(signed_value, buffers[1], 12) == NON_HAL_OK
+                     && strcmp((char *)buffers[1], reference) == 0, "i32 %s: '%s'", reference, buffers[1]);
+  int32_t signed_out = 0;
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_Int_32bit((uint8_t *)reference, 12, &signed_out, &length) == NON_HAL_OK
+                     && signed_out == strtol(reference, NULL, 10) && length == strlen(reference),
+                     "parse i32 %s: %" PRId32, reference, signed_out);
+
+  snprintf(reference, sizeof(reference), "%08" PRIX32, value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_HexString_32bit(value, buffers[2], 9) == NON_HAL_OK
+                     && strcmp((char *)buffers[2], reference) == 0, "hex32 %s: '%s'", reference, buffers[2]);
+  snprintf(reference, sizeof(reference), "0x%" PRIx32, value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_HexString_to_UInt_32bit((uint8_t *)reference, 11, &unsigned_out, &length) == NON_HAL_OK
+                     && unsigned_out == strtoul(reference, NULL, 16) && length == strlen(reference),
+                     "parse hex32 %s: %" PRIX32, reference, unsigned_out);
+
+  Test_Conv_Bin_Reference(value, 32, reference);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_BinString_32bit(signed_value, buffers[3], 33) == NON_HAL_OK
+                     && strcmp((char *)buffers[3], reference) == 0, "bin32 %s: '%s'", reference, buffers[3]);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_BinString_to_Int_32bit(buffers[3], &signed_out) == NON_HAL_OK
+                     && signed_out == signed_value, "parse bin32 %s: %" PRId32, reference, signed_out);
+
+  snprintf(reference, sizeof(reference), "%010" PRIu32, value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_Padded_32bit(value, 10, buffers[4], 11) == NON_HAL_OK
+                     && strcmp((char *)buffers[4], reference) == 0, "padded u32 %s: '%s'", reference, buffers[4]);
+  snprintf(reference, sizeof(reference), "%+011" PRId32, signed_value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_DecString_Padded_32bit(signed_value, 10, buffers[5], 12) == NON_HAL_OK
+                     && strcmp((char *)buffers[5], reference) == 0, "padded i32 %s: '%s'", reference, buffers[5]);
+}
+
+/**
+  * @brief  The function checks the 32-bit converters and parsers with every
+  *         stride-th value of 2^32 and values near powers of ten
+  * @param  stride a step of the sweep (1 for all values)
+  * @retval None
+  */
+static void Test_Conv_32bit(uint64_t stride)
+{
+  static const size_t sizes[6] = {11, 12, 9, 33, 11, 12};
+  uint8_t *buffers[6];
+  uint64_t checked = 0;
+  double start = Non_HAL_Test_Time();
+
+  for(uint32_t i = 0; i < 6; i++)
+  {
+    buffers[i] = Non_HAL_Test_Buffer(sizes[i]);
+  }
+  for(uint64_t value = 0; value <= UINT32_MAX; value += stride, checked++)
+  {
+    Test_Conv_32bit_Value((uint32_t)value, buffers);
+  }
+  for(uint64_t power = 1; power <= UINT32_MAX; power *= 10)
+  {
+    for(int32_t delta = -1; delta <= 1; delta++)
+    {
+      Test_Conv_32bit_Value((uint32_t)(power + delta), buffers);
+      Test_Conv_32bit_Value((uint32_t)(0U - power + delta), buffers);
+      checked += 2;
+    }
+  }
+  Test_Conv_32bit_Value(UINT32_MAX, buffers);
+  Test_Conv_32bit_Value((uint32_t)INT32_MAX + 1U, buffers);
+
+  // out of range values and the error of a small buffer
+  uint32_t unsigned_out = 0, length = 0;
+  int32_t signed_out = 0;
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_UInt_32bit((uint8_t *)"4294967296", 10, &unsigned_out, &length)
+                     == NON_HAL_ERROR && unsigned_out == UINT32_MAX, "parse u32 2^32: %" PRIu32, unsigned_out);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_Int_32bit((uint8_t *)"-2147483649", 11, &signed_out, &length)
+                     == NON_HAL_ERROR && signed_out == INT32_MIN, "parse i32 -2^31-1: %" PRId32, signed_out);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_UInt_32bit((uint8_t *)"x1", 2, &unsigned_out, &length)
+                     == NON_HAL_ERROR && length == 0, "parse u32 'x1'");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_32bit(0, buffers[0], 10) == NON_HAL_ERROR, "u32 sizebuf 10");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_DecString_32bit(0, buffers[1], 11) == NON_HAL_ERROR, "i32 sizebuf 11");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_HexString_32bit(0, buffers[2], 8) == NON_HAL_ERROR, "hex32 sizebuf 8");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_Padded_32bit(100000, 5, buffers[4], 11) == NON_HAL_ERROR,
+                     "padded u32 100000 width 5");
+
+  for(uint32_t i = 0; i < 6; i++)
+  {
+    free(buffers[i]);
+  }
+  char name[48];
+  snprintf(name, sizeof(name), "32-bit, stride %" PRIu64, stride);
+  Non_HAL_Test_Report(name, checked, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the 64-bit converters and parsers with one value
+  * @param  value a value
+  * @param  buffers buffers of the documented sizes: 21, 21, 17 and 65 bytes
+  * @retval None
+  */
+static void Test_Conv_64bit_Value(uint64_t value, uint8_t *buffers[4])
+{
+  char reference[72];
+  uint32_t length = 0;
+
+  snprintf(reference, sizeof(reference), "%" PRIu64, value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_64bit(value, buffers[0], 21) == NON_HAL_OK
+                     && strcmp((char *)buffers[0], reference) == 0, "u64 %s: '%s'", reference, buffers[0]);
+  uint64_t unsigned_out = 0;
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_UInt_64bit((uint8_t *)reference, 21, &unsigned_out, &length) == NON_HAL_OK
+                     && unsigned_out == strtoull(reference, NULL, 10) && length == strlen(reference),
+                     "parse u64 %s: %" PRIu64, reference, unsigned_out);
+
+  int64_t signed_value = (int64_t)value;
+  snprintf(reference, sizeof(reference), "%" PRId64, signed_value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_DecString_64bit(signed_value, buffers[1], 21) == NON_HAL_OK
+                     && strcmp((char *)buffers[1], reference) == 0, "i64 %s: '%s'", reference, buffers[1]);
+  int64_t signed_out = 0;
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_Int_64bit((uint8_t *)reference, 21, &signed_out, &length) == NON_HAL_OK
+                     && signed_out == strtoll(reference, NULL, 10) && length == strlen(reference),
+                     "parse i64 %s: %" PRId64, reference, signed_out);
+
+  snprintf(reference, sizeof(reference), "%016" PRIX64, value);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_HexString_64bit(value, buffers[2], 17) == NON_HAL_OK
+                     && strcmp((char *)buffers[2], reference) == 0, "hex64 %s: '%s'", reference, buffers[2]);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_HexString_to_UInt_64bit(buffers[2], 17, &unsigned_out, &length) == NON_HAL_OK
+                     && unsigned_out == value && length == 16, "parse hex64 %s: %" PRIX64, reference, unsigned_out);
+
+  Test_Conv_Bin_Reference(value, 64, reference);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Int_to_BinString_64bit(signed_value, buffers[3], 65) == NON_HAL_OK
+                     && strcmp((char *)buffers[3], reference) == 0, "bin64 %s: '%s'", reference, buffers[3]);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_BinString_to_Int_64bit(buffers[3], &signed_out) == NON_HAL_OK
+                     && signed_out == signed_value, "parse bin64 %s: %" PRId64, reference, signed_out);
+}
+
+/**
+  * @brief  The function checks the 64-bit converters and parsers with random
+  *         values of each length and values near powers of ten
+  * @param  count a number of random values
+  * @retval None
+  */
+static void Test_Conv_64bit(uint32_t count)
+{
+  static const size_t sizes[4] = {21, 21, 17, 65};
+  uint8_t *buffers[4];
+  double start = Non_HAL_Test_Time();
+
+  for(uint32_t i = 0; i < 4; i++)
+  {
+    buffers[i] = Non_HAL_Test_Buffer(sizes[i]);
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    // random values with a random number of bits, so all lengths are checked
+    Test_Conv_64bit_Value(Non_HAL_Test_Random() >> (i % 64), buffers);
+  }
+  for(uint64_t power = 1; power <= UINT64_MAX / 10; power *= 10)
+  {
+    for(int32_t delta = -1; delta <= 1; delta++)
+    {
+      Test_Conv_64bit_Value(power + (uint64_t)(int64_t)delta, buffers);
+      Test_Conv_64bit_Value(0U - power + (uint64_t)(int64_t)delta, buffers);
+    }
+  }
+  Test_Conv_64bit_Value(UINT64_MAX, buffers);
+  Test_Conv_64bit_Value((uint64_t)INT64_MAX + 1U, buffers);
+
+  uint64_t unsigned_out = 0;
+  int64_t signed_out = 0;
+  uint32_t length = 0;
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_UInt_64bit((uint8_t *)"18446744073709551616", 20, &unsigned_out, &length)
+                     == NON_HAL_ERROR && unsigned_out == UINT64_MAX, "parse u64 2^64");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_DecString_to_Int_64bit((uint8_t *)"-9223372036854775809", 20, &signed_out, &length)
+                     == NON_HAL_ERROR && signed_out == INT64_MIN, "parse i64 -2^63-1");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_UInt_to_DecString_64bit(0, buffers[0], 20) == NON_HAL_ERROR, "u64 sizebuf 20");
+
+  for(uint32_t i = 0; i < 4; i++)
+  {
+    free(buffers[i]);
+  }
+  Non_HAL_Test_Report("64-bit, random and powers of ten", count, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the float converters and the float parser
+  *         with one value
+  * @note   Non_HAL_CON_Float_to_DecString() prints 8 significant digits and
+  *         Non_HAL_CON_Float_to_DecString_Format() at most 8 significant
+  *         digits, the error of them is half a unit of the last digit and
+  *         the precision of float_const_table. Subnormal numbers are 0 for
+  *         both. The shortest string must convert back to the same bits.
+  * @param  bits bits of a float value
+  * @param  buffers buffers of 19, 16 and 64 bytes
+  * @retval None
+  */
+static void Test_Conv_Float_Value(uint32_t bits, uint8_t *buffers[3])
+{
+  float value = Test_Conv_Float(bits);
+  uint32_t exponent = (bits >> 23) & 0xFFU;
+  char reference[64];
+  uint32_t length = 0;
+  float float_out = 0;
+
+  // Non_HAL_CON_Float_to_DecString()
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString(value, buffers[0], 19) == NON_HAL_OK,
+                     "float %08" PRIX32 ": error", bits);
+  if(exponent == 0xFFU)
+  {
+    const char *special = (bits & 0x007FFFFFU) ? "nan" : (bits >> 31) ? "-inf" : "+inf";
+    NON_HAL_TEST_CHECK(strcmp((char *)buffers[0], special) == 0, "float %s: '%s'", special, buffers[0]);
+  }
+  else if(exponent == 0)
+  {
+    NON_HAL_TEST_CHECK(strcmp((char *)buffers[0], "0") == 0, "float %a: '%s'", (double)value, buffers[0]);
+  }
+  else
+  {
+    double parsed = strtod((char *)buffers[0], NULL);
+    NON_HAL_TEST_CHECK(fabs(parsed - (double)value) <= fabs((double)value) * (5.0e-8 + 3.8e-9)
+                       && !signbit(parsed) == !signbit(value), "float %.9g: '%s'", (double)value, buffers[0]);
+  }
+  // the string fits in a buffer of its length with \0 and doesn't fit in a smaller one
+  size_t size = strlen((char *)buffers[0]) + 1;
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString(value, buffers[0], (uint8_t)size) == NON_HAL_OK
+                     && Non_HAL_CON_Float_to_DecString(value, buffers[0], (uint8_t)(size - 1)) == NON_HAL_ERROR,
+                     "float %08" PRIX32 ": sizebuf %u", bits, (unsigned)size);
+
+  // Non_HAL_CON_Float_to_DecString_Shortest() and the parser
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString_Shortest(value, buffers[1], 16) == NON_HAL_OK,
+                     "shortest %08" PRIX32 ": error", bits);
+  if(value == value)
+  {
+    uint32_t parsed_bits = Test_Conv_Float_Bits(strtof((char *)buffers[1], NULL));
+    NON_HAL_TEST_CHECK(parsed_bits == bits, "shortest %08" PRIX32 ": '%s'", bits, buffers[1]);
+    Non_HAL_CON_DecString_to_Float(buffers[1], 16, &float_out, &length);
+    NON_HAL_TEST_CHECK(Test_Conv_Float_Bits(float_out) == bits && length == strlen((char *)buffers[1]),
+                       "parse float '%s': %08" PRIX32, buffers[1], Test_Conv_Float_Bits(float_out));
+
+    snprintf(reference, sizeof(reference), "%.6e", (double)value);
+    Non_HAL_CON_DecString_to_Float((uint8_t *)reference, sizeof(reference), &float_out, &length);
+    NON_HAL_TEST_CHECK(Test_Conv_Float_Bits(float_out) == Test_Conv_Float_Bits(strtof(reference, NULL)),
+                       "parse float '%s': %a", reference, (double)float_out);
+  }
+
+  // Non_HAL_CON_Float_to_DecString_Format()
+  if(exponent == 0xFFU)
+  {
+    const char *special = (bits & 0x007FFFFFU) ? "nan" : (bits >> 31) ? "-inf" : "+inf";
+    NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString_Format(value, 2, NON_HAL_CON_AUTO, buffers[2], 64) == NON_HAL_OK
+                       && strcmp((char *)buffers[2], special) == 0, "format %s: '%s'", special, buffers[2]);
+  }
+  if(exponent == 0 || exponent == 0xFFU)
+  {
+    return;
+  }
+  for(uint8_t precision = 0; precision <= NON_HAL_CON_FLOAT_PRECISION; precision++)
+  {
+    double magnitude = fabs((double)value);
+    double half_unit = 0.5 * pow(10.0, -(double)precision);
+
+    NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString_Format(value, precision, NON_HAL_CON_FIXED, buffers[2], 64)
+                       == NON_HAL_OK, "fixed %.9g %u: error", (double)value, precision);
+    const char *point = strchr((char *)buffers[2], '.');
+    NON_HAL_TEST_CHECK(strchr((char *)buffers[2], 'e') == NULL
+                       && (precision ? point != NULL && strlen(point + 1) == precision : point == NULL),
+                       "fixed %.9g %u: '%s'", (double)value, precision, buffers[2]);
+    double parsed = strtod((char *)buffers[2], NULL);
+    NON_HAL_TEST_CHECK(fabs(parsed - (double)value) <= (half_unit + magnitude * 1.1e-7) * (1.0 + 1e-12),
+                       "fixed %.9g %u: '%s'", (double)value, precision, buffers[2]);
+
+    NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString_Format(value, precision, NON_HAL_CON_SCIENTIFIC, buffers[2], 64)
+                       == NON_HAL_OK, "scientific %.9g %u: error", (double)value, precision);
+    parsed = strtod((char *)buffers[2], NULL);
+    NON_HAL_TEST_CHECK(strchr((char *)buffers[2], 'e') != NULL
+                       && fabs(parsed - (double)value) <= magnitude * (half_unit + 1.1e-7) * (1.0 + 1e-12),
+                       "scientific %.9g %u: '%s'", (double)value, precision, buffers[2]);
+  }
+}
+
+/**
+  * @brief  The function checks the float converters with random values of
+  *         each binary exponent and special values
+  * @param  per_exponent a number of random values of each exponent
+  * @retval None
+  */
+static void Test_Conv_Float_All(uint32_t per_exponent)
+{
+  static const uint32_t special[] =
+  {
+    0x00000000U, 0x80000000U, 0x00000001U, 0x007FFFFFU, 0x00800000U, 0x7F7FFFFFU, 0xFF7FFFFFU,
+    0x7F800000U, 0xFF800000U, 0x7FC00000U, 0xFFC00001U, 0x3F800000U, 0x3DCCCCCDU, 0xB3D6BF95U
+  };
+  uint8_t *buffers[3] = {Non_HAL_Test_Buffer(19), Non_HAL_Test_Buffer(16), Non_HAL_Test_Buffer(64)};
+  uint64_t checked = 0;
+  double start = Non_HAL_Test_Time();
+
+  for(uint32_t i = 0; i < sizeof(special) / sizeof(special[0]); i++, checked++)
+  {
+    Test_Conv_Float_Value(special[i], buffers);
+  }
+  for(uint32_t exponent = 0; exponent < 256; exponent++)
+  {
+    for(uint32_t i = 0; i < per_exponent; i++, checked++)
+    {
+      Test_Conv_Float_Value((exponent << 23) | ((uint32_t)Non_HAL_Test_Random() & 0x807FFFFFU), buffers);
+    }
+  }
+  // decimal values with few digits, where the rounding of the strings is visible
+  for(uint32_t i = 0; i < per_exponent * 16; i++, checked++)
+  {
+    float value = (float)((int32_t)(Non_HAL_Test_Random() % 2000001U) - 1000000) / 1000.0f;
+    Test_Conv_Float_Value(Test_Conv_Float_Bits(value), buffers);
+  }
+
+  uint8_t *small = Non_HAL_Test_Buffer(2);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString(0.0f, small, 2) == NON_HAL_OK && strcmp((char *)small, "0") == 0,
+                     "float 0 sizebuf 2: '%s'", small);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString(1.0f, small, 2) == NON_HAL_OK && strcmp((char *)small, "1") == 0,
+                     "float 1 sizebuf 2: '%s'", small);
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString(-1.0f, small, 2) == NON_HAL_ERROR, "float -1 sizebuf 2");
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Float_to_DecString(INFINITY, small, 2) == NON_HAL_ERROR, "float inf sizebuf 2");
+  free(small);
+
+  for(uint32_t i = 0; i < 3; i++)
+  {
+    free(buffers[i]);
+  }
+  Non_HAL_Test_Report("float, all exponents", checked, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the double converter and the double parser
+  *         with random bit patterns and random values of each exponent
+  * @param  count a number of values
+  * @retval None
+  */
+static void Test_Conv_Double(uint32_t count)
+{
+  uint8_t *buffer = Non_HAL_Test_Buffer(25);
+  char reference[40];
+  double start = Non_HAL_Test_Time();
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint64_t bits = Non_HAL_Test_Random();
+    if(i & 1U)
+    {
+      // an exponent from 2^-80 to 2^80, where the fixed notation is used
+      bits = (bits & 0x800FFFFFFFFFFFFFULL) | ((uint64_t)(1023 - 80 + (i >> 1) % 161) << 52);
+    }
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    NON_HAL_TEST_CHECK(Non_HAL_CON_Double_to_DecString_Shortest(value, buffer, 25) == NON_HAL_OK,
+                       "double %016" PRIX64 ": error", bits);
+    if(value != value)
+    {
+      NON_HAL_TEST_CHECK(strcmp((char *)buffer, "nan") == 0, "double nan: '%s'", buffer);
+      continue;
+    }
+    NON_HAL_TEST_CHECK(Test_Conv_Double_Bits(strtod((char *)buffer, NULL)) == bits,
+                       "double %016" PRIX64 ": '%s'", bits, buffer);
+    double double_out = 0;
+    uint32_t length = 0;
+    Non_HAL_CON_DecString_to_Double(buffer, 25, &double_out, &length);
+    NON_HAL_TEST_CHECK(Test_Conv_Double_Bits(double_out) == bits && length == strlen((char *)buffer),
+                       "parse double '%s': %016" PRIX64, buffer, Test_Conv_Double_Bits(double_out));
+
+    snprintf(reference, sizeof(reference), "%.*e", (int)(i % 20), value);
+    Non_HAL_CON_DecString_to_Double((uint8_t *)reference, sizeof(reference), &double_out, &length);
+    NON_HAL_TEST_CHECK(Test_Conv_Double_Bits(double_out) == Test_Conv_Double_Bits(strtod(reference, NULL)),
+                       "parse double '%s': %a", reference, double_out);
+  }
+  NON_HAL_TEST_CHECK(Non_HAL_CON_Double_to_DecString_Shortest(1.0, buffer, 24) == NON_HAL_ERROR,
+                     "double sizebuf 24");
+
+  free(buffer);
+  Non_HAL_Test_Report("double, random", count, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the array converters with random arrays and
+  *         buffers which are too small
+  * @param  count a number of arrays
+  * @retval None
+  */
+static void Test_Conv_Arrays(uint32_t count)
+{
+  enum { MAX_VALUES = 24 };
+  uint32_t values[MAX_VALUES];
+  uint8_t bytes[MAX_VALUES];
+  char reference[MAX_VALUES * 12 + 1];
+  uint8_t *buffer = Non_HAL_Test_Buffer(sizeof(reference));
+  double start = Non_HAL_Test_Time();
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint32_t number = (uint32_t)(Non_HAL_Test_Random() % (MAX_VALUES + 1));
+    uint8_t separator = (i & 1U) ? ',' : ' ';
+    for(uint32_t k = 0; k < number; k++)
+    {
+      values[k] = (uint32_t)Non_HAL_Test_Random() >> (Non_HAL_Test_Random() % 32);
+      bytes[k] = (uint8_t)values[k];
+    }
+
+    for(uint32_t kind = 0; kind < 4; kind++)
+    {
+      size_t used = 0;
+      reference[0] = 0;
+      for(uint32_t k = 0; k < number; k++)
+      {
+        const char *format = kind == 0 ? "%s%" PRIu32 : kind == 1 ? "%s%" PRId32 : kind == 2 ? "%s%02" PRIX32 : "%s%08" PRIX32;
+        char separator_text[2] = {(char)separator, 0};
+        uint32_t value = kind == 2 ? bytes[k] : values[k];
+        if(kind == 1)
+        {
+          used += (size_t)snprintf(reference + used, sizeof(reference) - used, format, k ? separator_text : "",
+                                   (int32_t)value);
+        }
+        else
+        {
+          used += (size_t)snprintf(reference + used, sizeof(reference) - used, format, k ? separator_text : "", value);
+        }
+      }
+
+      // a buffer of the exact size and a buffer which is too small
+      for(uint32_t small = 0; small < 2; small++)
+      {
+        uint32_t sizebuf = (uint32_t)used + 1U - small * (uint32_t)(Non_HAL_Test_Random() % (used + 1U));
+        uint32_t length = UINT32_MAX;
+        NON_HAL_StatusTypeDef status = NON_HAL_ERROR;
+        uint8_t *string = buffer + sizeof(reference) - sizebuf;
+        if(kind == 0)
+        {
+          status = Non_HAL_CON_UInt_Array_to_DecString_32bit(values, number, separator, string, sizebuf, &length);
+        }
+        else if(kind == 1)
+        {
+          status = Non_HAL_CON_Int_Array_to_DecString_32bit((int32_t *)values, number, separator, string, sizebuf,
+                                                            &length);
+        }
+        else if(kind == 2)
+        {
+          status = Non_HAL_CON_UInt_Array_to_HexString_8bit(bytes, number, separator, string, sizebuf, &length);
+        }
+        else
+        {
+          status = Non_HAL_CON_UInt_Array_to_HexString_32bit(values, number, separator, string, sizebuf, &length);
+        }
+        if(sizebuf == used + 1U)
+        {
+          NON_HAL_TEST_CHECK(status == NON_HAL_OK && length == used && strcmp((char *)string, reference) == 0,
+                             "array %" PRIu32 " '%s': '%s'", kind, reference, (char *)string);
+        }
+        else if(sizebuf > 0)
+        {
+          NON_HAL_TEST_CHECK(status == NON_HAL_ERROR && length < sizebuf && string[length] == 0
+                             && strncmp((char *)string, reference, length) == 0,
+                             "array %" PRIu32 " '%s' sizebuf %" PRIu32 ": '%s'", kind, reference, sizebuf,
+                             (char *)string);
+        }
+      }
+    }
+  }
+
+  free(buffer);
+  Non_HAL_Test_Report("arrays, random", count, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function prints the time of a converter and of the C library
+  *         function which does the same
+  * @param  name a name of the converter
+  * @param  library_ns the time of one call of the converter, ns
+  * @param  libc_ns the time of one call of the C library function, ns
+  * @retval None
+  */
+static void Test_Conv_Throughput_Report(const char *name, double library_ns, double libc_ns)
+{
+  printf("  %-32s %8.1f ns %8.1f ns %6.1fx\n", name, library_ns, libc_ns, libc_ns / library_ns);
+}
+
+/**
+  * @brief  The function measures the throughput of the converters and of the
+  *         C library functions on the same random values
+  * @note   The numbers are only comparable between builds with the same
+  *         flags, the sanitizers slow the library down much more than the
+  *         C library. The non_hal_bench target measures an optimized build.
+  * @param  count a number of values
+  * @retval None
+  */
+static void Test_Conv_Throughput(uint32_t count)
+{
+  uint32_t *values = malloc(count * sizeof(uint32_t));
+  float *floats = malloc(count * sizeof(float));
+  double *doubles = malloc(count * sizeof(double));
+  char (*strings)[32] = malloc(count * sizeof(strings[0]));
+  uint8_t buffer[32];
+  volatile uint32_t sink = 0;
+  double time[3];
+
+  if(values == NULL || floats == NULL || doubles == NULL || strings == NULL)
+  {
+    printf("FAIL: no memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for(uint32_t i = 0; i < count; i++)
+  {
+    values[i] = (uint32_t)Non_HAL_Test_Random();
+    floats[i] = (float)((int32_t)(Non_HAL_Test_Random() % 2000001U) - 1000000) / 1000.0f;
+    uint64_t bits = (Non_HAL_Test_Random() & 0x800FFFFFFFFFFFFFULL) | ((uint64_t)(1023 - 60 + i % 121) << 52);
+    memcpy(&doubles[i], &bits, sizeof(double));
+  }
+  printf("throughput (%" PRIu32 " values)  %-21s non hal       libc\n", count, "");
+
+#define TEST_CONV_TIME(INDEX, STATEMENT)                                       \
+  do                                                                           \
+  {                                                                            \
+    double begin = Non_HAL_Test_Time();                                        \
+    for(uint32_t i = 0; i < count; i++)                                        \
+    {                                                                          \
+      STATEMENT;                                                               \
+      sink += buffer[0];                                                       \
+    }                                                                          \
+    time[INDEX] = (Non_HAL_Test_Time() - begin) * 1e9 / count;                 \
+  } while(0)
+
+  TEST_CONV_TIME(0, Non_HAL_CON_UInt_to_DecString_32bit(values[i], buffer, sizeof(buffer)));
+  TEST_CONV_TIME(1, snprintf((char *)buffer, sizeof(buffer), "%" PRIu32, values[i]));
+  Test_Conv_Throughput_Report("UInt_to_DecString_32bit", time[0], time[1]);
+
+  TEST_CONV_TIME(0, Non_HAL_CON_UInt_to_HexString_32bit(values[i], buffer, sizeof(buffer)));
+  TEST_CONV_TIME(1, snprintf((char *)buffer, sizeof(buffer), "%08" PRIX32, values[i]));
+  Test_Conv_Throughput_Report("UInt_to_HexString_32bit", time[0], time[1]);
+
+  TEST_CONV_TIME(0, Non_HAL_CON_Float_to_DecString(floats[i], buffer, sizeof(buffer)));
+  TEST_CONV_TIME(1, snprintf((char *)buffer, sizeof(buffer), "%.8g", (double)floats[i]));
+  Test_Conv_Throughput_Report("Float_to_DecString", time[0], time[1]);
+
+  TEST_CONV_TIME(0, Non_HAL_CON_Float_to_DecString_Format(floats[i], 2, NON_HAL_CON_FIXED, buffer, sizeof(buffer)));
+  TEST_CONV_TIME(1, snprintf((char *)buffer, sizeof(buffer), "%.2f", (double)floats[i]));
+  Test_Conv_Throughput_Report("Float_to_DecString_Format", time[0], time[1]);
+
+  TEST_CONV_TIME(0, Non_HAL_CON_Float_to_DecString_Shortest(floats[i], buffer, sizeof(buffer)));
+  TEST_CONV_TIME(1, snprintf((char *)buffer, sizeof(buffer), "%.9g", (double)floats[i]));
+  Test_Conv_Throughput_Report("Float_to_DecString_Shortest", time[0], time[1]);
+
+  TEST_CONV_TIME(0, Non_HAL_CON_Double_to_DecString_Shortest(doubles[i], buffer, sizeof(buffer)));
+  TEST_CONV_TIME(1, snprintf((char *)buffer, sizeof(buffer), "%.17g", doubles[i]));
+  Test_Conv_Throughput_Report("Double_to_DecString_Shortest", time[0], time[1]);
+
+  uint32_t length = 0;
+  for(uint32_t i = 0; i < count; i++)
+  {
+    snprintf(strings[i], sizeof(strings[i]), "%" PRIu32, values[i]);
+  }
+  TEST_CONV_TIME(0, uint32_t out; Non_HAL_CON_DecString_to_UInt_32bit((uint8_t *)strings[i], 32, &out, &length);
+                 buffer[0] = (uint8_t)out);
+  TEST_CONV_TIME(1, buffer[0] = (uint8_t)strtoul(strings[i], NULL, 10));
+  Test_Conv_Throughput_Report("DecString_to_UInt_32bit", time[0], time[1]);
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    snprintf(strings[i], sizeof(strings[i]), "%.9g", (double)floats[i]);
+  }
+  TEST_CONV_TIME(0, float out; Non_HAL_CON_DecString_to_Float((uint8_t *)strings[i], 32, &out, &length);
+                 buffer[0] = (uint8_t)out);
+  TEST_CONV_TIME(1, buffer[0] = (uint8_t)strtof(strings[i], NULL));
+  Test_Conv_Throughput_Report("DecString_to_Float", time[0], time[1]);
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    snprintf(strings[i], sizeof(strings[i]), "%.17g", doubles[i]);
+  }
+  TEST_CONV_TIME(0, double out; Non_HAL_CON_DecString_to_Double((uint8_t *)strings[i], 32, &out, &length);
+                 buffer[0] = (uint8_t)(out != 0));
+  TEST_CONV_TIME(1, buffer[0] = (uint8_t)(strtod(strings[i], NULL) != 0));
+  Test_Conv_Throughput_Report("DecString_to_Double", time[0], time[1]);
+
+#undef TEST_CONV_TIME
+  (void)sink;
+  free(values);
+  free(floats);
+  free(doubles);
+  free(strings);
+}
+
+/**
+  * @brief  The test of the converters
+  * @param  argc a number of arguments
+  * @param  argv arguments: [stride of the 32-bit sweep]
+  * @retval EXIT_SUCCESS if all checks passed
+  */
+int main(int argc, char **argv)
+{
+  uint64_t stride = 4099;
+  if(argc > 1)
+  {
+    stride = strtoull(argv[1], NULL, 0);
+    if(stride == 0)
+    {
+      printf("usage: %s [stride]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  Test_Conv_Small();
+  Test_Conv_32bit(stride);
+  Test_Conv_64bit(200000);
+  Test_Conv_Float_All(200);
+  Test_Conv_Double(200000);
+  Test_Conv_Arrays(20000);
+  Test_Conv_Throughput(TEST_CONV_THROUGHPUT);
+
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
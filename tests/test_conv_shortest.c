@@ -0,0 +1,172 @@
+/**
+  ******************************************************************************
+  * @file       test_conv_shortest.c
+  * @brief      The round-trip test of Non_HAL_CON_Float_to_DecString_Shortest():
+  *             the string of each checked float bit pattern must convert back
+  *             to the same bits with strtof(), and (for a sample) it must have
+  *             no more significant digits than the shortest "%.*e" string of
+  *             the C library which converts back.
+  *
+  *             Usage: test_conv_shortest [stride]
+  *             Every stride-th pattern of 2^32 is checked (1021 by default,
+  *             1 for all patterns).
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_conv.h"
+#include "non_hal_test.h"
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief Every n-th checked pattern is also checked for the minimal length
+  */
+#define TEST_SHORTEST_MINIMAL_EVERY   64U
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function counts significant digits of a string: digits of the
+  *         mantissa without leading zeros and, for a string without a point
+  *         and an exponent, without trailing zeros
+  * @param  decstr a pointer on a character string
+  * @retval a number of significant digits
+  */
+static uint32_t Test_Shortest_Digits(const char *decstr)
+{
+  uint32_t digits = 0, zeros = 0;
+  bool leading = true;
+  for(; *decstr != 0 && *decstr != 'e'; decstr++)
+  {
+    if(*decstr < '0' || *decstr > '9')
+    {
+      continue;
+    }
+    if(*decstr == '0')
+    {
+      if(!leading)
+      {
+        zeros++;
+      }
+      continue;
+    }
+    leading = false;
+    digits += zeros + 1U;
+    zeros = 0;
+  }
+  return digits;
+}
+
+/**
+  * @brief  The function returns the number of significant digits of the
+  *         shortest "%.*e" string which converts back to the value
+  * @param  value a float value
+  * @retval a number of significant digits (from 1 to 9)
+  */
+static uint32_t Test_Shortest_Reference(float value)
+{
+  char reference[32];
+  for(int precision = 0; precision < 8; precision++)
+  {
+    snprintf(reference, sizeof(reference), "%.*e", precision, (double)value);
+    if(strtof(reference, NULL) == value)
+    {
+      return (uint32_t)precision + 1U;
+    }
+  }
+  return 9;
+}
+
+/**
+  * @brief  The test of the shortest float converter
+  * @param  argc a number of arguments
+  * @param  argv arguments: [stride]
+  * @retval EXIT_SUCCESS if all checks passed
+  */
+int main(int argc, char **argv)
+{
+  uint64_t stride = 1021;
+  if(argc > 1)
+  {
+    stride = strtoull(argv[1], NULL, 0);
+    if(stride == 0)
+    {
+      printf("usage: %s [stride]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // a buffer of the documented size, so the address sanitizer finds a write past it
+  uint8_t *decstr = Non_HAL_Test_Buffer(16);
+  uint64_t checked = 0, minimal = 0;
+  double start = Non_HAL_Test_Time();
+
+  for(uint64_t pattern = 0; pattern <= UINT32_MAX; pattern += stride, checked++)
+  {
+    uint32_t bits = (uint32_t)pattern;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    if(Non_HAL_CON_Float_to_DecString_Shortest(value, decstr, 16) != NON_HAL_OK)
+    {
+      NON_HAL_TEST_CHECK(false, "%08" PRIX32 ": error", bits);
+      continue;
+    }
+    if(value != value)
+    {
+      NON_HAL_TEST_CHECK(strcmp((char *)decstr, "nan") == 0, "%08" PRIX32 ": '%s'", bits, decstr);
+      continue;
+    }
+    float parsed = strtof((char *)decstr, NULL);
+    uint32_t parsed_bits;
+    memcpy(&parsed_bits, &parsed, sizeof(parsed_bits));
+    NON_HAL_TEST_CHECK(parsed_bits == bits, "%08" PRIX32 ": '%s' converts back to %08" PRIX32, bits, decstr,
+                       parsed_bits);
+
+    if(checked % TEST_SHORTEST_MINIMAL_EVERY == 0 && value != 0 && parsed == parsed && parsed - parsed == 0)
+    {
+      uint32_t digits = Test_Shortest_Digits((char *)decstr);
+      uint32_t reference = Test_Shortest_Reference(value);
+      NON_HAL_TEST_CHECK(digits <= reference, "%08" PRIX32 ": '%s' has %" PRIu32 " digits, %" PRIu32 " are enough",
+                         bits, decstr, digits, reference);
+      minimal++;
+    }
+  }
+  free(decstr);
+
+  char name[64];
+  snprintf(name, sizeof(name), "shortest round trip, stride %" PRIu64, stride);
+  Non_HAL_Test_Report(name, checked, Non_HAL_Test_Time() - start);
+  printf("minimal length checked for %" PRIu64 " values\n", minimal);
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,358 @@
+/**
+  ******************************************************************************
+  * @file       test_filter.c
+  * @brief      The host test of the low-cost filters: the sliding median against a
+  *             sorted window, the moving average against a double sum and the
+  *             block functions against the single sample ones.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_lib.h"
+#include "non_hal_test.h"
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of samples of a test signal
+  */
+#define TEST_FILTER_SAMPLES   50000U
+
+/** @brief The longest block of the block functions
+  */
+#define TEST_FILTER_BLOCK     300U
+
+/** @brief The documented error of Filt_Avg() with the window of SIZE values
+  *        relative to the mean of the absolute values of the window
+  */
+#define TEST_FILTER_AVG_ERROR(SIZE)   (1e-7 * (2.0 + sqrt((double)(SIZE))))
+
+/* Variables -----------------------------------------------------------------*/
+
+/** @brief Sizes of the window of the moving average filter
+  */
+static const uint32_t test_filter_avg_sizes[] = {1, 2, 7, 64, 1000, 4096};
+
+/** @brief Sizes of the window of the sliding median filter above 40 (all
+  *        sizes from 1 to 40 are checked too)
+  */
+static const uint32_t test_filter_med_sizes[] = {1000, 1001, FILT_MED_MAX_SIZE};
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function returns a pseudo-random value from -1 to 1
+  * @retval the value
+  */
+static float Test_Filter_Noise(void)
+{
+  return (float)(Non_HAL_Test_Random() >> 40) / (float)(1U << 23) - 1.0f;
+}
+
+/**
+  * @brief  The function returns a random length of a block
+  * @param  left a number of samples left
+  * @retval the length (from 0 to TEST_FILTER_BLOCK, at most left)
+  */
+static size_t Test_Filter_Length(size_t left)
+{
+  size_t length = (size_t)(Non_HAL_Test_Random() % (TEST_FILTER_BLOCK + 1U));
+  return (length < left) ? length : left;
+}
+
+/**
+  * @brief  The function checks Filt_Avg() against the mean of the window
+  *         summed in double precision and Filt_Avg_Block() against Filt_Avg()
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Filter_Average(const float *signal, size_t n)
+{
+  float *single = malloc(n * sizeof(float));
+  float *block = malloc(n * sizeof(float));
+  double start = Non_HAL_Test_Time();
+
+  for(size_t s = 0; s < sizeof(test_filter_avg_sizes) / sizeof(test_filter_avg_sizes[0]); s++)
+  {
+    uint32_t size = test_filter_avg_sizes[s];
+    float *window = malloc(size * sizeof(float));
+    float *blockwindow = malloc(size * sizeof(float));
+    Filter_Average_Struct filter;
+    Filter_Average_Struct blockfilter;
+    double sum = 0.0, magnitude = 0.0, error = 0.0;
+
+    NON_HAL_TEST_CHECK(Filt_Avg_Init(&filter, window, 0) == NON_HAL_ERROR, "avg: size 0 accepted");
+    Filt_Avg_Init(&filter, window, size);
+    Filt_Avg_Init(&blockfilter, blockwindow, size);
+    for(size_t i = 0; i < n; i++)
+    {
+      size_t count = (i < size) ? i + 1U : size;
+      single[i] = Filt_Avg(&filter, signal[i]);
+      sum += (double)signal[i];
+      magnitude += fabs((double)signal[i]);
+      if(i >= size)
+      {
+        sum -= (double)signal[i - size];
+        magnitude -= fabs((double)signal[i - size]);
+      }
+      error = fmax(error, fabs((double)single[i] - sum / (double)count) / (magnitude / (double)count));
+    }
+    // odd sizes are filtered in place
+    memcpy(block, signal, n * sizeof(float));
+    for(size_t i = 0, length; i < n; i += length)
+    {
+      length = Test_Filter_Length(n - i);
+      Filt_Avg_Block(&blockfilter, (s & 1U) ? &block[i] : &signal[i], &block[i], length);
+    }
+    NON_HAL_TEST_CHECK(error <= TEST_FILTER_AVG_ERROR(size), "avg %u: error %g", size, error);
+    NON_HAL_TEST_CHECK(memcmp(single, block, n * sizeof(float)) == 0, "avg %u: block differs", size);
+    free(window);
+    free(blockwindow);
+  }
+  free(single);
+  free(block);
+  Non_HAL_Test_Report("Filt_Avg", n * sizeof(test_filter_avg_sizes) / sizeof(test_filter_avg_sizes[0]),
+                      Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function finds the first value of a sorted array which isn't
+  *         less than a value
+  * @param  sorted a pointer on the sorted array
+  * @param  count a number of values in the array
+  * @param  value the value
+  * @retval an index of the found value (count if all values are less)
+  */
+static size_t Test_Filter_Lower(const float *sorted, size_t count, float value)
+{
+  size_t low = 0;
+
+  while(count > 0)
+  {
+    size_t half = count / 2U;
+    if(sorted[low + half] < value)
+    {
+      low += half + 1U;
+      count -= half + 1U;
+    }
+    else
+    {
+      count = half;
+    }
+  }
+  return low;
+}
+
+/**
+  * @brief  The function checks Filt_Med() with a window of size values
+  *         against the middle of the window kept sorted and Filt_Med_Block()
+  *         against Filt_Med()
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @param  size a size of the window
+  * @retval None
+  */
+static void Test_Filter_Median_Size(const float *signal, size_t n, uint32_t size)
+{
+  float *window = malloc(size * sizeof(float));
+  float *blockwindow = malloc(size * sizeof(float));
+  int16_t *index = malloc(FILT_MED_INDEX_SIZE(size) * sizeof(int16_t));
+  int16_t *blockindex = malloc(FILT_MED_INDEX_SIZE(size) * sizeof(int16_t));
+  float *sorted = malloc(size * sizeof(float));
+  float *block = malloc(n * sizeof(float));
+  Filter_Median_Struct filter;
+  Filter_Median_Struct blockfilter;
+  size_t count = 0, differs = 0, blockdiffers = 0;
+
+  NON_HAL_TEST_CHECK(Filt_Med_Init(&filter, window, index, size) == NON_HAL_OK, "med %u: init", size);
+  Filt_Med_Init(&blockfilter, blockwindow, blockindex, size);
+  memcpy(block, signal, n * sizeof(float));
+  for(size_t i = 0, length; i < n; i += length)
+  {
+    length = Test_Filter_Length(n - i);
+    Filt_Med_Block(&blockfilter, &block[i], &block[i], length);
+  }
+  for(size_t i = 0; i < n; i++)
+  {
+    float output = Filt_Med(&filter, signal[i]);
+    float median;
+    size_t j;
+    if(count == size)
+    {
+      // the oldest value leaves the sorted window
+      j = Test_Filter_Lower(sorted, count, signal[i - size]);
+      memmove(&sorted[j], &sorted[j + 1U], (--count - j) * sizeof(float));
+    }
+    j = Test_Filter_Lower(sorted, count, signal[i]);
+    memmove(&sorted[j + 1U], &sorted[j], (count++ - j) * sizeof(float));
+    sorted[j] = signal[i];
+    median = sorted[count / 2U];
+    if((count & 1U) == 0)
+    {
+      median = (median + sorted[count / 2U - 1U]) * 0.5f;
+    }
+    differs += memcmp(&output, &median, sizeof(float)) != 0;
+    blockdiffers += memcmp(&output, &block[i], sizeof(float)) != 0;
+  }
+  NON_HAL_TEST_CHECK(differs == 0, "med %u: %zu outputs differ from the sorted window", size, differs);
+  NON_HAL_TEST_CHECK(blockdiffers == 0, "med %u: %zu outputs of the block differ", size, blockdiffers);
+  free(window);
+  free(blockwindow);
+  free(index);
+  free(blockindex);
+  free(sorted);
+  free(block);
+}
+
+/**
+  * @brief  The function checks the sliding median filter with all windows
+  *         from 1 to 40 values and with big windows
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Filter_Median(const float *signal, size_t n)
+{
+  Filter_Median_Struct filter;
+  float window[1];
+  int16_t index[FILT_MED_INDEX_SIZE(1)];
+  uint64_t checked = 0;
+  double start = Non_HAL_Test_Time();
+
+  NON_HAL_TEST_CHECK(Filt_Med_Init(&filter, window, index, 0) == NON_HAL_ERROR, "med: size 0 accepted");
+  NON_HAL_TEST_CHECK(Filt_Med_Init(&filter, window, index, FILT_MED_MAX_SIZE + 1U) == NON_HAL_ERROR,
+                     "med: size %u accepted", FILT_MED_MAX_SIZE + 1U);
+  for(uint32_t size = 1; size <= 40U; size++)
+  {
+    Test_Filter_Median_Size(signal, n, size);
+    checked += n;
+  }
+  for(size_t s = 0; s < sizeof(test_filter_med_sizes) / sizeof(test_filter_med_sizes[0]); s++)
+  {
+    Test_Filter_Median_Size(signal, n, test_filter_med_sizes[s]);
+    checked += n;
+  }
+  Non_HAL_Test_Report("Filt_Med", checked, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks Filt_EMA_Block() and Filt_AB_Block() against
+  *         Filt_EMA() and Filt_AB(), the first value starts the filters
+  *         unchanged, the parameters out of range are rejected
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Filter_EMA_AB(const float *signal, size_t n)
+{
+  float *single = malloc(n * sizeof(float));
+  float *block = malloc(n * sizeof(float));
+  Filter_EMA_Struct ema;
+  Filter_EMA_Struct blockema;
+  Filter_Alpha_Beta_Struct ab;
+  Filter_Alpha_Beta_Struct blockab;
+  double start = Non_HAL_Test_Time();
+
+  NON_HAL_TEST_CHECK(Filt_EMA_Init(&ema, 0.0f) == NON_HAL_ERROR && Filt_EMA_Init(&ema, 1.5f) == NON_HAL_ERROR,
+                     "ema: alpha out of range accepted");
+  NON_HAL_TEST_CHECK(Filt_AB_Init(&ab, 0.5f, 3.0f, 0.01f) == NON_HAL_ERROR &&
+                     Filt_AB_Init(&ab, 0.5f, 0.1f, 0.0f) == NON_HAL_ERROR, "ab: unstable gains accepted");
+
+  Filt_EMA_Init(&ema, 0.05f);
+  Filt_EMA_Init(&blockema, 0.05f);
+  for(size_t i = 0; i < n; i++)
+  {
+    single[i] = Filt_EMA(&ema, signal[i]);
+  }
+  memcpy(block, signal, n * sizeof(float));
+  for(size_t i = 0, length; i < n; i += length)
+  {
+    length = Test_Filter_Length(n - i);
+    Filt_EMA_Block(&blockema, &block[i], &block[i], length);
+  }
+  NON_HAL_TEST_CHECK(single[0] == signal[0], "ema: the first value %g", (double)single[0]);
+  NON_HAL_TEST_CHECK(memcmp(single, block, n * sizeof(float)) == 0, "ema: block differs");
+
+  Filt_AB_Init(&ab, 0.2f, 0.01f, 0.001f);
+  Filt_AB_Init(&blockab, 0.2f, 0.01f, 0.001f);
+  for(size_t i = 0; i < n; i++)
+  {
+    single[i] = Filt_AB(&ab, signal[i]);
+  }
+  for(size_t i = 0, length; i < n; i += length)
+  {
+    length = Test_Filter_Length(n - i);
+    Filt_AB_Block(&blockab, &signal[i], &block[i], length);
+  }
+  NON_HAL_TEST_CHECK(single[0] == signal[0], "ab: the first value %g", (double)single[0]);
+  NON_HAL_TEST_CHECK(memcmp(single, block, n * sizeof(float)) == 0, "ab: block differs");
+  NON_HAL_TEST_CHECK(memcmp(&ab, &blockab, sizeof(ab)) == 0, "ab: state differs");
+
+  free(single);
+  free(block);
+  Non_HAL_Test_Report("Filt_EMA, Filt_AB", 2U * n, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The main function of the test
+  * @retval EXIT_SUCCESS if all checks pass
+  */
+int main(void)
+{
+  float *signal = malloc(TEST_FILTER_SAMPLES * sizeof(float));
+
+  // a noisy sine at an offset of 1000, every 8th sample is a spike and
+  // values repeat, so the median sees equal values
+  for(size_t i = 0; i < TEST_FILTER_SAMPLES; i++)
+  {
+    signal[i] = 1000.0f + sinf((float)i * 0.001f) + 0.1f * Test_Filter_Noise();
+    if(i % 8U == 0)
+    {
+      signal[i] += 10.0f * Test_Filter_Noise();
+    }
+    if(i % 5U == 0)
+    {
+      signal[i] = roundf(signal[i]);
+    }
+  }
+  Test_Filter_Average(signal, TEST_FILTER_SAMPLES);
+  Test_Filter_Median(signal, TEST_FILTER_SAMPLES);
+  Test_Filter_EMA_AB(signal, TEST_FILTER_SAMPLES);
+
+  free(signal);
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file       test_kalmbank.c
+  * @brief      The host test of the bank of the fast Kalman filters: every kernel
+  *             which runs on this core against Filt_Kalm() channel by channel.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_lib.h"
+#include "non_hal_test.h"
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of samples of each channel
+  */
+#define TEST_KALM_BANK_SAMPLES   50000U
+
+/** @brief The largest number of channels
+  */
+#define TEST_KALM_BANK_CHANNELS  61U
+
+/* Variables -----------------------------------------------------------------*/
+
+/** @brief Kernels of the bank and the documented difference from Filt_Kalm()
+  *        (relative to max(|output|, 1), 0 is bit-identical; the tests are
+  *        built as ISO C, the compiler doesn't contract Filt_Kalm() into FMA)
+  */
+static const struct
+{
+  Filter_Kalman_Bank_Kernel kernel;
+  const char *name;
+  float tolerance;
+} test_kalm_bank_kernels[] =
+{
+  {FILT_KALM_BANK_SCALAR, "scalar", 0.0f},
+  {FILT_KALM_BANK_SSE,    "SSE",    0.0f},
+  {FILT_KALM_BANK_AVX2,   "AVX2",   0.0f},
+  {FILT_KALM_BANK_NEON,   "NEON",   1e-4f}
+};
+
+/** @brief Numbers of channels (the SIMD kernels have tails of 1 - 7 channels)
+  */
+static const uint32_t test_kalm_bank_channels[] = {1, 3, 4, 7, 8, 9, 16, TEST_KALM_BANK_CHANNELS};
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function returns a pseudo-random value from -1 to 1
+  * @retval the value
+  */
+static float Test_Kalm_Bank_Noise(void)
+{
+  return (float)(Non_HAL_Test_Random() >> 40) / (float)(1U << 23) - 1.0f;
+}
+
+/**
+  * @brief  The function checks a kernel of the bank against Filt_Kalm() for
+  *         several numbers of channels, each channel has its own parameters
+  *         and a noisy sine of its own phase
+  * @param  index an index of the kernel in test_kalm_bank_kernels
+  * @retval None
+  */
+static void Test_Kalm_Bank_Kernel(uint32_t index)
+{
+  Filter_Kalman_Bank_Kernel kernel = test_kalm_bank_kernels[index].kernel;
+  float tolerance = test_kalm_bank_kernels[index].tolerance;
+  float work[FILT_KALM_BANK_WORK_SIZE(TEST_KALM_BANK_CHANNELS)];
+  Filter_Kalman_Struct filters[TEST_KALM_BANK_CHANNELS];
+  Filter_Kalman_Struct stored;
+  float in[TEST_KALM_BANK_CHANNELS];
+  float out[TEST_KALM_BANK_CHANNELS];
+  float bankout[TEST_KALM_BANK_CHANNELS];
+  float *result;
+  Filter_Kalman_Bank_Struct bank;
+  uint64_t checked = 0;
+  double start = Non_HAL_Test_Time();
+  char name[64];
+
+  snprintf(name, sizeof(name), "Filt_Kalm_Bank %s", test_kalm_bank_kernels[index].name);
+  for(uint32_t c = 0; c < sizeof(test_kalm_bank_channels) / sizeof(test_kalm_bank_channels[0]); c++)
+  {
+    uint32_t channels = test_kalm_bank_channels[c];
+
+    NON_HAL_TEST_CHECK(Filt_Kalm_Bank_Init(&bank, work, channels, 0.1f, 0.01f) == NON_HAL_OK, "bank init");
+    if(Filt_Kalm_Bank_Set_Kernel(&bank, kernel) != NON_HAL_OK)
+    {
+      printf("%-36s skipped, the kernel can't run on this core\n", name);
+      return;
+    }
+    for(uint32_t i = 0; i < channels; i++)
+    {
+      Filt_Kalm_Init(&filters[i], 0.01f + 0.19f * (float)i / TEST_KALM_BANK_CHANNELS,
+                     (i % 4U == 0) ? 0.001f : (i % 4U == 1) ? 0.01f : (i % 4U == 2) ? 0.1f : 1.0f);
+      NON_HAL_TEST_CHECK(Filt_Kalm_Bank_Load(&bank, i, &filters[i]) == NON_HAL_OK, "load %u", i);
+    }
+    NON_HAL_TEST_CHECK(Filt_Kalm_Bank_Load(&bank, channels, &filters[0]) == NON_HAL_ERROR, "load %u", channels);
+
+    for(uint32_t n = 0; n < TEST_KALM_BANK_SAMPLES; n++)
+    {
+      for(uint32_t i = 0; i < channels; i++)
+      {
+        in[i] = 0.5f * sinf((float)n * 0.001f + (float)i) + 0.1f * Test_Kalm_Bank_Noise();
+        out[i] = Filt_Kalm(&filters[i], in[i]);
+      }
+      // odd samples are filtered in place
+      result = (n & 1U) ? in : bankout;
+      Filt_Kalm_Bank(&bank, in, result);
+      for(uint32_t i = 0; i < channels; i++)
+      {
+        float limit = tolerance * fmaxf(fabsf(out[i]), 1.0f);
+        NON_HAL_TEST_CHECK((tolerance == 0.0f) ? memcmp(&result[i], &out[i], sizeof(float)) == 0
+                                               : fabsf(result[i] - out[i]) <= limit,
+                           "%s, %u channels, channel %u, sample %u: %.9g, Filt_Kalm %.9g", name, channels, i, n,
+                           (double)result[i], (double)out[i]);
+      }
+    }
+    if(tolerance == 0.0f)
+    {
+      for(uint32_t i = 0; i < channels; i++)
+      {
+        Filt_Kalm_Bank_Store(&bank, i, &stored);
+        NON_HAL_TEST_CHECK(stored.errestimate == filters[i].errestimate && stored.lastestimate == filters[i].lastestimate
+                           && stored.kalmangain == filters[i].kalmangain, "%s, channel %u: state differs", name, i);
+      }
+    }
+    checked += (uint64_t)channels * TEST_KALM_BANK_SAMPLES;
+  }
+  Non_HAL_Test_Report(name, checked, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The main function of the test
+  * @retval EXIT_SUCCESS if all checks pass
+  */
+int main(void)
+{
+  for(uint32_t i = 0; i < sizeof(test_kalm_bank_kernels) / sizeof(test_kalm_bank_kernels[0]); i++)
+  {
+    Test_Kalm_Bank_Kernel(i);
+  }
+
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,621 @@
+/**
+  ******************************************************************************
+  * @file       test_kalmfilter.c
+  * @brief      The host test of the fast Kalman filter: the properties which
+  *             are documented in the notes of non_hal_kalmfilter.c.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_lib.h"
+#include "non_hal_test.h"
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of samples of a test signal
+  */
+#define TEST_KALM_SAMPLES   200000U
+
+/** @brief The longest block of the block functions
+  */
+#define TEST_KALM_BLOCK     1000U
+
+/** @brief A number of samples of the accuracy tests of the fixed-point filters
+  */
+#define TEST_KALM_FIXED_SAMPLES   200000U
+
+/** @brief The filters with constant parameters against Filt_Kalm() with the
+  *        same parameters
+  */
+FILT_KALM_CONST_DEFINE(Test_Kalm_Const_Float, float, 0.1f, 0.01f)
+FILT_KALM_CONST_DEFINE(Test_Kalm_Const_Double, double, 0.1f, 0.01f)
+
+/* Variables -----------------------------------------------------------------*/
+
+/** @brief Parameters of the filters (ErrMeasure, Speed)
+  */
+static const float test_kalm_params[][2] =
+{
+  {0.01f, 0.001f}, {0.1f, 0.01f}, {0.1f, 0.1f}, {0.2f, 1.0f}
+};
+
+/** @brief ErrMeasure of the accuracy tests of the fixed-point filters
+  */
+static const float test_kalm_fixed_errmeasure[] = {0.01f, 0.05f, 0.1f, 0.2f};
+
+/** @brief Speed of the accuracy tests and the documented bounds of the
+  *        deviation from Filt_Kalm(): Speed, max error of Filt_Kalm_Q15() in
+  *        LSB, max error of Filt_Kalm_Q31() (full scale is 1)
+  */
+static const float test_kalm_fixed_bounds[][3] =
+{
+  {0.001f, 100.0f, 1.5e-5f}, {0.01f, 32.0f, 1e-6f}, {0.1f, 8.0f, 1e-6f}, {1.0f, 20.0f, 1e-6f}
+};
+
+/** @brief Parameters of the filters which freeze the Kalman Gain and the
+  *        documented bounds against Filt_Kalm() (ErrMeasure = 0,1,
+  *        Jump = 0,3): Speed, Epsilon, max error, least share of frozen
+  *        samples
+  */
+static const float test_kalm_adaptive_params[][4] =
+{
+  {0.001f, 0.05f, 4.7e-3f, 0.48f}, {0.01f, 0.05f, 3.2e-3f, 0.75f},
+  {0.01f, 0.2f, 9.8e-3f, 0.96f}, {0.1f, 0.2f, 9.3e-3f, 0.71f}
+};
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function returns a pseudo-random value from -1 to 1
+  * @retval the value
+  */
+static float Test_Kalm_Noise(void)
+{
+  return (float)(Non_HAL_Test_Random() >> 40) / (float)(1U << 23) - 1.0f;
+}
+
+/**
+  * @brief  The function makes a noisy sine with amplitude 0,5 and a step of 1
+  *         in the middle
+  * @param  signal a pointer on an array for the samples
+  * @param  n a number of samples
+  * @param  noise an amplitude of the noise
+  * @retval None
+  */
+static void Test_Kalm_Signal(float *signal, size_t n, float noise)
+{
+  for(size_t i = 0; i < n; i++)
+  {
+    signal[i] = 0.5f * sinf((float)i * 0.001f) + noise * Test_Kalm_Noise() + ((i >= n / 2) ? 1.0f : 0.0f);
+  }
+}
+
+/**
+  * @brief  The function returns a random length of a block
+  * @param  left a number of samples left
+  * @retval the length (from 0 to TEST_KALM_BLOCK, at most left)
+  */
+static size_t Test_Kalm_Length(size_t left)
+{
+  size_t length = (size_t)(Non_HAL_Test_Random() % (TEST_KALM_BLOCK + 1U));
+  return (length < left) ? length : left;
+}
+
+/**
+  * @brief  The function checks that Filt_Kalm_Block() gives the same bits as
+  *         Filt_Kalm() for every sample, also in place (in == out)
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Kalm_Block(const float *signal, size_t n)
+{
+  float *single = malloc(n * sizeof(float));
+  float *block = malloc(n * sizeof(float));
+  double start = Non_HAL_Test_Time();
+
+  for(size_t p = 0; p < sizeof(test_kalm_params) / sizeof(test_kalm_params[0]); p++)
+  {
+    Filter_Kalman_Struct filter;
+    Filter_Kalman_Struct blockfilter;
+
+    Filt_Kalm_Init(&filter, test_kalm_params[p][0], test_kalm_params[p][1]);
+    Filt_Kalm_Init(&blockfilter, test_kalm_params[p][0], test_kalm_params[p][1]);
+    for(size_t i = 0; i < n; i++)
+    {
+      single[i] = Filt_Kalm(&filter, signal[i]);
+    }
+    // odd parameter sets are filtered in place
+    memcpy(block, signal, n * sizeof(float));
+    for(size_t i = 0, length; i < n; i += length)
+    {
+      length = Test_Kalm_Length(n - i);
+      NON_HAL_TEST_CHECK(Filt_Kalm_Block(&blockfilter, (p & 1U) ? &block[i] : &signal[i], &block[i], length)
+                         == NON_HAL_OK, "block %zu: error", i);
+    }
+    NON_HAL_TEST_CHECK(memcmp(single, block, n * sizeof(float)) == 0, "block %zu: output differs", p);
+    NON_HAL_TEST_CHECK(filter.errestimate == blockfilter.errestimate && filter.lastestimate == blockfilter.lastestimate
+                       && filter.kalmangain == blockfilter.kalmangain, "block %zu: state differs", p);
+  }
+  free(single);
+  free(block);
+  Non_HAL_Test_Report("Filt_Kalm_Block", n * sizeof(test_kalm_params) / sizeof(test_kalm_params[0]),
+                      Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the filters of FILT_KALM_CONST_DEFINE(): the
+  *         float filter and its block function give the same bits as
+  *         Filt_Kalm(), the double filter differs by less than
+  *         1e-5 * max(|output|, 1)
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Kalm_Const(const float *signal, size_t n)
+{
+  float *block = malloc(n * sizeof(float));
+  double start = Non_HAL_Test_Time();
+  Filter_Kalman_Struct filter;
+  Filter_Kalman_Struct stored;
+  Test_Kalm_Const_Float_Struct single;
+  Test_Kalm_Const_Float_Struct blockfilter;
+  Test_Kalm_Const_Double_Struct precise;
+  size_t differs = 0, imprecise = 0;
+
+  Filt_Kalm_Init(&filter, 0.1f, 0.01f);
+  Test_Kalm_Const_Float_Init(&single);
+  Test_Kalm_Const_Float_Init(&blockfilter);
+  Test_Kalm_Const_Double_Init(&precise);
+  memcpy(block, signal, n * sizeof(float));
+  for(size_t i = 0, length; i < n; i += length)
+  {
+    length = Test_Kalm_Length(n - i);
+    Test_Kalm_Const_Float_Block(&blockfilter, &block[i], &block[i], length);
+  }
+  for(size_t i = 0; i < n; i++)
+  {
+    float output = Filt_Kalm(&filter, signal[i]);
+    float constant = Test_Kalm_Const_Float(&single, signal[i]);
+    double error = fabs(Test_Kalm_Const_Double(&precise, signal[i]) - (double)output);
+    differs += memcmp(&output, &constant, sizeof(float)) != 0 || memcmp(&output, &block[i], sizeof(float)) != 0;
+    imprecise += error > 1e-5 * fmax(fabs((double)output), 1.0);
+  }
+  Test_Kalm_Const_Float_Store(&blockfilter, &stored);
+  NON_HAL_TEST_CHECK(differs == 0, "const: %zu outputs of the float filter differ", differs);
+  NON_HAL_TEST_CHECK(imprecise == 0, "const: %zu outputs of the double filter differ", imprecise);
+  NON_HAL_TEST_CHECK(memcmp(&stored, &filter, sizeof(filter)) == 0, "const: the stored state differs");
+  free(block);
+  Non_HAL_Test_Report("FILT_KALM_CONST_DEFINE", n, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the filters which freeze the Kalman Gain:
+  *         Filt_Kalm_Adaptive_Block() gives the same bits and statistics as
+  *         Filt_Kalm_Adaptive(), the deviation from Filt_Kalm() and the share
+  *         of frozen samples are the documented ones
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Kalm_Adaptive(const float *signal, size_t n)
+{
+  float *block = malloc(n * sizeof(float));
+  double start = Non_HAL_Test_Time();
+
+  for(size_t p = 0; p < sizeof(test_kalm_adaptive_params) / sizeof(test_kalm_adaptive_params[0]); p++)
+  {
+    const float *param = test_kalm_adaptive_params[p];
+    Filter_Kalman_Struct filter;
+    Filter_Kalman_Adaptive_Struct single;
+    Filter_Kalman_Adaptive_Struct blockfilter;
+    size_t differs = 0;
+    float error = 0.0f;
+    float frozen;
+
+    Filt_Kalm_Init(&filter, 0.1f, param[0]);
+    NON_HAL_TEST_CHECK(Filt_Kalm_Adaptive_Init(&single, 0.1f, param[0], param[1], 0.3f) == NON_HAL_OK,
+                       "adaptive %zu: init error", p);
+    Filt_Kalm_Adaptive_Init(&blockfilter, 0.1f, param[0], param[1], 0.3f);
+    memcpy(block, signal, n * sizeof(float));
+    for(size_t i = 0, length; i < n; i += length)
+    {
+      length = Test_Kalm_Length(n - i);
+      NON_HAL_TEST_CHECK(Filt_Kalm_Adaptive_Block(&blockfilter, &block[i], &block[i], length) == NON_HAL_OK,
+                         "adaptive %zu: block %zu: error", p, i);
+    }
+    for(size_t i = 0; i < n; i++)
+    {
+      float output = Filt_Kalm_Adaptive(&single, signal[i]);
+      differs += memcmp(&output, &block[i], sizeof(float)) != 0;
+      error = fmaxf(error, fabsf(output - Filt_Kalm(&filter, signal[i])));
+    }
+    frozen = (float)single.fastcount / (float)n;
+    NON_HAL_TEST_CHECK(differs == 0, "adaptive %zu: %zu outputs of the block differ", p, differs);
+    NON_HAL_TEST_CHECK(memcmp(&single, &blockfilter, sizeof(single)) == 0, "adaptive %zu: state differs", p);
+    NON_HAL_TEST_CHECK(single.fullcount + single.fastcount == n, "adaptive %zu: %u + %u samples", p,
+                       (unsigned)single.fullcount, (unsigned)single.fastcount);
+    NON_HAL_TEST_CHECK(error <= param[2], "adaptive %zu: max error %g", p, error);
+    NON_HAL_TEST_CHECK(frozen >= param[3], "adaptive %zu: frozen %.1f %%", p, frozen * 100.0f);
+    NON_HAL_TEST_CHECK(single.freezes > 0 && single.thaws > 0, "adaptive %zu: %u freezes, %u thaws", p,
+                       (unsigned)single.freezes, (unsigned)single.thaws);
+  }
+  free(block);
+  Non_HAL_Test_Report("Filt_Kalm_Adaptive", n * sizeof(test_kalm_adaptive_params) /
+                      sizeof(test_kalm_adaptive_params[0]), Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks that a gated filter with the state of
+  *         single gives the same bits and the same state in blocks
+  * @param  single a pointer on the gated filter before the samples
+  * @param  in a pointer on an array of samples
+  * @param  out a pointer on an array of outputs of Filt_Kalm_Gated()
+  * @param  n a number of samples
+  * @param  name a name of the part for the failed checks
+  * @retval None
+  */
+static void Test_Kalm_Gated_Block(const Filter_Kalman_Gated_Struct *single, const float *in, const float *out,
+                                  size_t n, const char *name)
+{
+  Filter_Kalman_Gated_Struct blockfilter = *single;
+  Filter_Kalman_Gated_Struct filter = *single;
+  float *block = malloc(n * sizeof(float));
+
+  memcpy(block, in, n * sizeof(float));
+  for(size_t i = 0, length; i < n; i += length)
+  {
+    length = Test_Kalm_Length(n - i);
+    NON_HAL_TEST_CHECK(Filt_Kalm_Gated_Block(&blockfilter, &block[i], &block[i], length) == NON_HAL_OK,
+                       "gated %s: block %zu: error", name, i);
+  }
+  for(size_t i = 0; i < n; i++)
+  {
+    Filt_Kalm_Gated(&filter, in[i]);
+  }
+  NON_HAL_TEST_CHECK(memcmp(block, out, n * sizeof(float)) == 0, "gated %s: output of the block differs", name);
+  NON_HAL_TEST_CHECK(memcmp(&blockfilter, &filter, sizeof(filter)) == 0, "gated %s: state of the block differs",
+                     name);
+  free(block);
+}
+
+/**
+  * @brief  The function checks the filter which rejects outliers, NaN and
+  *         infinite samples: it starts from the first finite sample far from
+  *         0, NaN and infinite samples and outliers leave the estimate as it
+  *         is, a step is reacquired after Reacquire outliers, with
+  *         Gate = INFINITY it is Filt_Kalm() started from the first sample,
+  *         the block function gives the same bits and state as the single
+  *         sample function
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Kalm_Gated(const float *signal, size_t n)
+{
+  float *in = malloc(n * sizeof(float));
+  float *out = malloc(n * sizeof(float));
+  Filter_Kalman_Gated_Struct filter;
+  Filter_Kalman_Gated_Struct start;
+  Filter_Kalman_Struct reference;
+  size_t nonfinite = 0, corrupted = 0, differs = 0;
+  double time = Non_HAL_Test_Time();
+
+  NON_HAL_TEST_CHECK(Filt_Kalm_Gated_Init(&filter, 0.1f, 0.01f, 0.0f, 0) == NON_HAL_ERROR, "gated: Gate 0 accepted");
+
+  // acquisition of a constant far from 0 without the restart: the first
+  // sample starts the filter, so nothing is rejected
+  Filt_Kalm_Gated_Init(&filter, 0.1f, 0.01f, 4.0f, 0);
+  start = filter;
+  for(size_t i = 0; i < 1000U; i++)
+  {
+    in[i] = 5.0f + 0.01f * Test_Kalm_Noise();
+    out[i] = Filt_Kalm_Gated(&filter, in[i]);
+  }
+  NON_HAL_TEST_CHECK(out[0] == in[0], "gated acquisition: the first output %g", (double)out[0]);
+  NON_HAL_TEST_CHECK(filter.accepted == 1000U && filter.rejected == 0 && filter.reacquired == 0,
+                     "gated acquisition: %u accepted, %u rejected, %u reacquired", (unsigned)filter.accepted,
+                     (unsigned)filter.rejected, (unsigned)filter.reacquired);
+  NON_HAL_TEST_CHECK(fabsf(out[999] - 5.0f) < 0.01f, "gated acquisition: the output %g", (double)out[999]);
+  Test_Kalm_Gated_Block(&start, in, out, 1000U, "acquisition");
+
+  // a step of 5 is rejected 20 times and the next sample restarts the filter
+  Filt_Kalm_Gated_Init(&filter, 0.1f, 0.01f, 4.0f, 20U);
+  start = filter;
+  for(size_t i = 0; i < 1000U; i++)
+  {
+    in[i] = (i < 500U) ? 0.0f : 5.0f;
+    out[i] = Filt_Kalm_Gated(&filter, in[i]);
+  }
+  NON_HAL_TEST_CHECK(out[519] == 0.0f && out[520] == 5.0f && out[999] == 5.0f,
+                     "gated step: outputs %g, %g, %g", (double)out[519], (double)out[520], (double)out[999]);
+  NON_HAL_TEST_CHECK(filter.rejected == 20U && filter.reacquired == 1U && filter.accepted == 979U,
+                     "gated step: %u accepted, %u rejected, %u reacquired", (unsigned)filter.accepted,
+                     (unsigned)filter.rejected, (unsigned)filter.reacquired);
+  Test_Kalm_Gated_Block(&start, in, out, 1000U, "step");
+
+  // NaN before the first finite sample, then 1 % of NaN and infinite
+  // samples and 1 % of outliers of 100 in the noisy sine: the step of 1 is
+  // inside the gate, so only the outliers are rejected
+  memcpy(in, signal, n * sizeof(float));
+  in[0] = NAN;
+  for(size_t i = 1; i < n; i++)
+  {
+    uint64_t random = Non_HAL_Test_Random() % 200U;
+    if(random < 2U)
+    {
+      in[i] = (random == 0) ? NAN : (i & 1U) ? INFINITY : -INFINITY;
+      nonfinite++;
+    }
+    else if(random < 4U)
+    {
+      in[i] += (random == 2U) ? 100.0f : -100.0f;
+      corrupted++;
+    }
+  }
+  Filt_Kalm_Gated_Init(&filter, 0.1f, 0.01f, 4.0f, 20U);
+  start = filter;
+  for(size_t i = 0; i < n; i++)
+  {
+    out[i] = Filt_Kalm_Gated(&filter, in[i]);
+    differs += !(fabsf(out[i]) <= FLT_MAX) || (!(fabsf(in[i]) <= FLT_MAX) && i > 0 && out[i] != out[i - 1U]);
+  }
+  NON_HAL_TEST_CHECK(out[0] == 0.0f && out[1] == in[1], "gated NaN: the first outputs %g, %g", (double)out[0],
+                     (double)out[1]);
+  NON_HAL_TEST_CHECK(differs == 0, "gated NaN: %zu outputs are infinite or NaN or changed by them", differs);
+  NON_HAL_TEST_CHECK(filter.invalid == nonfinite + 1U, "gated NaN: %u invalid of %zu", (unsigned)filter.invalid,
+                     nonfinite + 1U);
+  NON_HAL_TEST_CHECK(filter.rejected == corrupted && filter.reacquired == 0, "gated NaN: %u rejected of %zu "
+                     "outliers, %u reacquired", (unsigned)filter.rejected, corrupted, (unsigned)filter.reacquired);
+  NON_HAL_TEST_CHECK(filter.accepted + filter.rejected + filter.invalid + filter.reacquired == n,
+                     "gated NaN: the counters don't add up to %zu", n);
+  Test_Kalm_Gated_Block(&start, in, out, n, "NaN");
+
+  // Gate = INFINITY takes every finite sample as Filt_Kalm() started from
+  // the first one
+  Filt_Kalm_Gated_Init(&filter, 0.1f, 0.01f, INFINITY, 0);
+  Filt_Kalm_Init(&reference, 0.1f, 0.01f);
+  reference.lastestimate = signal[0];
+  differs = Filt_Kalm_Gated(&filter, signal[0]) != signal[0];
+  for(size_t i = 1; i < n; i++)
+  {
+    float output = Filt_Kalm(&reference, signal[i]);
+    float gated = Filt_Kalm_Gated(&filter, signal[i]);
+    differs += memcmp(&output, &gated, sizeof(float)) != 0;
+  }
+  NON_HAL_TEST_CHECK(differs == 0, "gated INFINITY: %zu outputs differ from Filt_Kalm()", differs);
+
+  free(in);
+  free(out);
+  Non_HAL_Test_Report("Filt_Kalm_Gated", 2U * n + 4000U, Non_HAL_Test_Time() - time);
+}
+
+/** @brief Decimation factors and orders of the CIC prefilter of the test of
+  *        Filt_Kalm_Decim()
+  */
+static const uint32_t test_kalm_decim_params[][2] = {{1U, 1U}, {1U, 2U}, {3U, 1U}, {3U, 2U},
+                                                     {10U, 1U}, {10U, 2U}, {100U, 1U}, {100U, 2U}};
+
+/**
+  * @brief  The function checks the decimating filter: Filt_Kalm_Decim_Block()
+  *         gives the same bits and state as Filt_Kalm_Decim() for blocks of
+  *         random lengths and writes at most FILT_KALM_DECIM_OUT_SIZE()
+  *         values, the output is Filt_Kalm() of the weighted means of the
+  *         samples computed in double, the error measure is scaled to the
+  *         noise of a decimated value
+  * @param  signal a pointer on an array of samples
+  * @param  n a number of samples
+  * @retval None
+  */
+static void Test_Kalm_Decim(const float *signal, size_t n)
+{
+  float *block = malloc((n + 1U) * sizeof(float));
+  double start = Non_HAL_Test_Time();
+  Filter_Kalman_Decim_Struct single;
+
+  NON_HAL_TEST_CHECK(Filt_Kalm_Decim_Init(&single, 0.1f, 0.01f, 0, 1U) == NON_HAL_ERROR, "decim: Factor 0 accepted");
+  NON_HAL_TEST_CHECK(Filt_Kalm_Decim_Init(&single, 0.1f, 0.01f, 10U, 3U) == NON_HAL_ERROR, "decim: Order 3 accepted");
+
+  for(size_t p = 0; p < sizeof(test_kalm_decim_params) / sizeof(test_kalm_decim_params[0]); p++)
+  {
+    uint32_t factor = test_kalm_decim_params[p][0];
+    uint32_t order = test_kalm_decim_params[p][1];
+    double m = (double)factor;
+    double errmeasure = (order == 1U) ? 0.1 / sqrt(m) : 0.1 * sqrt((2.0 * m + 1.0) / (3.0 * m * (m + 1.0)));
+    Filter_Kalman_Decim_Struct blockfilter;
+    Filter_Kalman_Struct reference;
+    size_t written = 0, differs = 0, outputs = 0;
+    double error = 0.0;
+
+    NON_HAL_TEST_CHECK(Filt_Kalm_Decim_Init(&single, 0.1f, 0.01f, factor, order) == NON_HAL_OK,
+                       "decim %zu: init error", p);
+    NON_HAL_TEST_CHECK(fabs((double)single.filter.errmeasure - errmeasure) <= 1e-6 * errmeasure,
+                       "decim %zu: ErrMeasure %g instead of %g", p, (double)single.filter.errmeasure, errmeasure);
+    blockfilter = single;
+    Filt_Kalm_Init(&reference, single.filter.errmeasure, 0.01f);
+    for(size_t i = 0, length; i < n; i += length)
+    {
+      size_t blockwritten;
+      length = Test_Kalm_Length(n - i);
+      NON_HAL_TEST_CHECK(Filt_Kalm_Decim_Block(&blockfilter, &signal[i], length, &block[written],
+                                               &blockwritten) == NON_HAL_OK, "decim %zu: block %zu: error", p, i);
+      NON_HAL_TEST_CHECK(blockwritten <= FILT_KALM_DECIM_OUT_SIZE(length, factor),
+                         "decim %zu: %zu outputs of %zu samples", p, blockwritten, length);
+      written += blockwritten;
+    }
+    for(size_t i = 0; i < n; i++)
+    {
+      float output;
+      if(Filt_Kalm_Decim(&single, signal[i], &output))
+      {
+        // the triangle of order 2 takes the previous samples equal to the
+        // current ones for the first output
+        size_t first = i + 1U - factor;
+        size_t previous = (order == 2U && first >= factor) ? first - factor : first;
+        double value = 0.0;
+        for(size_t j = 0; j < factor; j++)
+        {
+          value += (double)signal[first + j] * ((order == 1U) ? 1.0 : (double)(factor - j));
+          value += (order == 1U) ? 0.0 : (double)signal[previous + j] * (double)(j + 1U);
+        }
+        value /= (order == 1U) ? m : m * (m + 1.0);
+        error = fmax(error, fabs((double)Filt_Kalm(&reference, (float)value) - (double)output));
+        differs += outputs >= written || memcmp(&output, &block[outputs], sizeof(float)) != 0;
+        outputs++;
+      }
+    }
+    NON_HAL_TEST_CHECK(outputs == n / factor && written == outputs, "decim %zu: %zu and %zu outputs of %zu samples",
+                       p, outputs, written, n);
+    NON_HAL_TEST_CHECK(differs == 0, "decim %zu: %zu outputs of the block differ", p, differs);
+    NON_HAL_TEST_CHECK(memcmp(&single, &blockfilter, sizeof(single)) == 0, "decim %zu: state differs", p);
+    NON_HAL_TEST_CHECK(error <= 1e-6, "decim %zu: max error %g", p, error);
+  }
+  free(block);
+  Non_HAL_Test_Report("Filt_Kalm_Decim", 2U * n * sizeof(test_kalm_decim_params) /
+                      sizeof(test_kalm_decim_params[0]), Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function returns a noisy sine with amplitude 0,5, the signal
+  *         of the documented accuracy of the fixed-point filters
+  * @param  i a number of the sample
+  * @retval the sample
+  */
+static float Test_Kalm_Fixed_Signal(size_t i)
+{
+  return 0.5f * sinf((float)i * 0.001f) + 0.1f * Test_Kalm_Noise();
+}
+
+/**
+  * @brief  The function checks the deviation of Filt_Kalm_Q15() from
+  *         Filt_Kalm() fed with the same Q15 samples against the bounds in the
+  *         notes of Filt_Kalm_Q15()
+  * @retval None
+  */
+static void Test_Kalm_Q15(void)
+{
+  double start = Non_HAL_Test_Time();
+
+  // the same noise whatever parts of the test ran before
+  non_hal_test_seed = 88172645463325252ULL;
+
+  for(size_t e = 0; e < sizeof(test_kalm_fixed_errmeasure) / sizeof(test_kalm_fixed_errmeasure[0]); e++)
+  {
+    for(size_t p = 0; p < sizeof(test_kalm_fixed_bounds) / sizeof(test_kalm_fixed_bounds[0]); p++)
+    {
+      int16_t errmeasure = (int16_t)lrintf(test_kalm_fixed_errmeasure[e] * 32768.0f);
+      int16_t speed = (int16_t)fminf(lrintf(test_kalm_fixed_bounds[p][0] * 32768.0f), 32767.0f);
+      Filter_Kalman_Struct filter;
+      Filter_Kalman_Q15_Struct fixed;
+      float maxerror = 0.0f;
+
+      Filt_Kalm_Init(&filter, test_kalm_fixed_errmeasure[e], test_kalm_fixed_bounds[p][0]);
+      NON_HAL_TEST_CHECK(Filt_Kalm_Init_Q15(&fixed, errmeasure, speed) == NON_HAL_OK, "Q15: init error");
+      for(size_t i = 0; i < TEST_KALM_FIXED_SAMPLES; i++)
+      {
+        int16_t value = (int16_t)lrintf(Test_Kalm_Fixed_Signal(i) * 32768.0f);
+        float error = fabsf((float)Filt_Kalm_Q15(&fixed, value) - Filt_Kalm(&filter, (float)value / 32768.0f) * 32768.0f);
+        maxerror = fmaxf(maxerror, error);
+      }
+      NON_HAL_TEST_CHECK(maxerror <= test_kalm_fixed_bounds[p][1], "Q15: ErrMeasure %g, Speed %g: max error %g LSB",
+                         (double)test_kalm_fixed_errmeasure[e], (double)test_kalm_fixed_bounds[p][0], (double)maxerror);
+    }
+  }
+  Non_HAL_Test_Report("Filt_Kalm_Q15", TEST_KALM_FIXED_SAMPLES * sizeof(test_kalm_fixed_errmeasure)
+                      / sizeof(test_kalm_fixed_errmeasure[0]) * sizeof(test_kalm_fixed_bounds)
+                      / sizeof(test_kalm_fixed_bounds[0]), Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function checks the deviation of Filt_Kalm_Q31() from
+  *         Filt_Kalm() fed with the same Q31 samples against the bounds in the
+  *         notes of Filt_Kalm_Q31()
+  * @retval None
+  */
+static void Test_Kalm_Q31(void)
+{
+  double start = Non_HAL_Test_Time();
+
+  // the same noise whatever parts of the test ran before
+  non_hal_test_seed = 88172645463325252ULL;
+
+  for(size_t e = 0; e < sizeof(test_kalm_fixed_errmeasure) / sizeof(test_kalm_fixed_errmeasure[0]); e++)
+  {
+    for(size_t p = 0; p < sizeof(test_kalm_fixed_bounds) / sizeof(test_kalm_fixed_bounds[0]); p++)
+    {
+      int32_t errmeasure = (int32_t)llrint(test_kalm_fixed_errmeasure[e] * 2147483648.0);
+      int32_t speed = (int32_t)fmin(llrint(test_kalm_fixed_bounds[p][0] * 2147483648.0), 2147483647.0);
+      Filter_Kalman_Struct filter;
+      Filter_Kalman_Q31_Struct fixed;
+      double maxerror = 0.0;
+
+      Filt_Kalm_Init(&filter, test_kalm_fixed_errmeasure[e], test_kalm_fixed_bounds[p][0]);
+      NON_HAL_TEST_CHECK(Filt_Kalm_Init_Q31(&fixed, errmeasure, speed) == NON_HAL_OK, "Q31: init error");
+      for(size_t i = 0; i < TEST_KALM_FIXED_SAMPLES; i++)
+      {
+        int32_t value = (int32_t)llrint(Test_Kalm_Fixed_Signal(i) * 2147483648.0);
+        double error = fabs((double)Filt_Kalm_Q31(&fixed, value) / 2147483648.0
+                            - (double)Filt_Kalm(&filter, (float)((double)value / 2147483648.0)));
+        maxerror = fmax(maxerror, error);
+      }
+      NON_HAL_TEST_CHECK(maxerror <= test_kalm_fixed_bounds[p][2], "Q31: ErrMeasure %g, Speed %g: max error %g",
+                         (double)test_kalm_fixed_errmeasure[e], (double)test_kalm_fixed_bounds[p][0], maxerror);
+    }
+  }
+  Non_HAL_Test_Report("Filt_Kalm_Q31", TEST_KALM_FIXED_SAMPLES * sizeof(test_kalm_fixed_errmeasure)
+                      / sizeof(test_kalm_fixed_errmeasure[0]) * sizeof(test_kalm_fixed_bounds)
+                      / sizeof(test_kalm_fixed_bounds[0]), Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The main function of the test
+  * @retval EXIT_SUCCESS if all checks pass
+  */
+int main(void)
+{
+  float *signal = malloc(TEST_KALM_SAMPLES * sizeof(float));
+
+  Test_Kalm_Signal(signal, TEST_KALM_SAMPLES, 0.1f);
+  Test_Kalm_Block(signal, TEST_KALM_SAMPLES);
+  Test_Kalm_Const(signal, TEST_KALM_SAMPLES);
+  Test_Kalm_Adaptive(signal, TEST_KALM_SAMPLES);
+  Test_Kalm_Gated(signal, TEST_KALM_SAMPLES);
+  Test_Kalm_Decim(signal, TEST_KALM_SAMPLES);
+  Test_Kalm_Q15();
+  Test_Kalm_Q31();
+
+  free(signal);
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,428 @@
+/**
+  ******************************************************************************
+  * @file       test_kalmmatrix.c
+  * @brief      The host test of the linear Kalman filter: with one state it
+  *             is the fast Kalman filter, with random models it follows
+  *             a double precision filter in the standard form with an
+  *             explicit inverse, and the covariance stays exactly
+  *             symmetric.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_lib.h"
+#include "non_hal_kalmmatrix.h"
+#include "non_hal_test.h"
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of samples of the test against Filt_Kalm()
+  */
+#define TEST_MATRIX_SAMPLES   100000U
+
+/** @brief A number of steps of a random model
+  */
+#define TEST_MATRIX_STEPS     5000U
+
+/** @brief The largest difference from the reference relative to the largest
+  *        value of x or P of the reference
+  */
+#define TEST_MATRIX_ERROR     5e-5
+
+/* Variables -----------------------------------------------------------------*/
+
+/** @brief Sizes of the random models (N, M): the sizes with the unrolled
+  *        kernels, the generic ones and M > N
+  */
+static const uint32_t test_matrix_sizes[][2] =
+{
+  {1, 1}, {2, 1}, {3, 1}, {4, 2}, {6, 3}, {9, 3}, {5, 2}, {2, 3}, {7, 7}, {9, 9}
+};
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function returns a pseudo-random value from -1 to 1
+  * @retval the value
+  */
+static double Test_Matrix_Random(void)
+{
+  return (double)(Non_HAL_Test_Random() >> 11) * 0x1p-52 - 1.0;
+}
+
+/**
+  * @brief  The function checks that the filter with one state, F = H = 1,
+  *         R = ErrMeasure and Q = Speed * |the last change of x| follows
+  *         Filt_Kalm() with the same parameters
+  * @retval None
+  */
+static void Test_Matrix_Scalar(void)
+{
+  static const float params[][2] = {{0.01f, 0.001f}, {0.1f, 0.01f}, {0.1f, 0.1f}, {0.2f, 1.0f}};
+  double start = Non_HAL_Test_Time();
+
+  for(size_t p = 0; p < sizeof(params) / sizeof(params[0]); p++)
+  {
+    float work[FILT_KALM_MATRIX_WORK_SIZE(1, 1)];
+    Filter_Kalman_Matrix_Struct matrix;
+    Filter_Kalman_Struct filter;
+    double maxerror = 0.0;
+
+    NON_HAL_TEST_CHECK(Filt_Kalm_Matrix_Init(&matrix, work, 1, 1) == NON_HAL_OK, "scalar: init error");
+    matrix.P[0] = params[p][0];
+    matrix.R[0] = params[p][0];
+    Filt_Kalm_Init(&filter, params[p][0], params[p][1]);
+    for(size_t i = 0; i < TEST_MATRIX_SAMPLES; i++)
+    {
+      float z = 0.5f * sinf((float)i * 0.001f) + 0.1f * (float)Test_Matrix_Random();
+      float last = matrix.x[0];
+      float output = Filt_Kalm(&filter, z);
+      NON_HAL_TEST_CHECK(Filt_Kalm_Matrix(&matrix, &z) == NON_HAL_OK, "scalar: update error");
+      maxerror = fmax(maxerror, fabs((double)matrix.x[0] - output) / fmax(fabs((double)output), 1.0));
+      matrix.Q[0] = fabsf(matrix.x[0] - last) * params[p][1];
+    }
+    NON_HAL_TEST_CHECK(maxerror <= TEST_MATRIX_ERROR, "scalar: ErrMeasure %g, Speed %g: error %g",
+                       (double)params[p][0], (double)params[p][1], maxerror);
+  }
+  Non_HAL_Test_Report("Filt_Kalm_Matrix 1 x 1", TEST_MATRIX_SAMPLES * sizeof(params) / sizeof(params[0]),
+                      Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The function inverts a matrix with the Gauss-Jordan elimination
+  * @param  A a pointer on the matrix (m x m), it is replaced with the inverse
+  * @param  m a size of the matrix
+  * @retval None
+  */
+static void Test_Matrix_Inverse(double *A, uint32_t m)
+{
+  double B[FILT_KALM_MATRIX_MAX_SIZE * FILT_KALM_MATRIX_MAX_SIZE * 2];
+
+  for(uint32_t i = 0; i < m; i++)
+  {
+    for(uint32_t j = 0; j < 2 * m; j++)
+    {
+      B[i * 2 * m + j] = (j < m) ? A[i * m + j] : (j - m == i);
+    }
+  }
+  for(uint32_t c = 0; c < m; c++)
+  {
+    uint32_t pivot = c;
+    for(uint32_t i = c + 1; i < m; i++)
+    {
+      pivot = (fabs(B[i * 2 * m + c]) > fabs(B[pivot * 2 * m + c])) ? i : pivot;
+    }
+    for(uint32_t j = 0; j < 2 * m; j++)
+    {
+      double t = B[c * 2 * m + j];
+      B[c * 2 * m + j] = B[pivot * 2 * m + j];
+      B[pivot * 2 * m + j] = t;
+    }
+    double d = B[c * 2 * m + c];
+    for(uint32_t j = 0; j < 2 * m; j++)
+    {
+      B[c * 2 * m + j] /= d;
+    }
+    for(uint32_t i = 0; i < m; i++)
+    {
+      double f = B[i * 2 * m + c];
+      for(uint32_t j = 0; i != c && j < 2 * m; j++)
+      {
+        B[i * 2 * m + j] -= f * B[c * 2 * m + j];
+      }
+    }
+  }
+  for(uint32_t i = 0; i < m; i++)
+  {
+    memcpy(&A[i * m], &B[i * 2 * m + m], m * sizeof(double));
+  }
+}
+
+/**
+  * @brief  The function makes one step of the reference filter in double
+  *         precision: the standard form and an explicit inverse of S
+  * @param  pData a pointer on the float filter with the model
+  * @param  x a pointer on the state of the reference (n)
+  * @param  P a pointer on the covariance of the reference (n x n)
+  * @param  z a pointer on a measurement (m)
+  * @retval None
+  */
+static void Test_Matrix_Reference(const Filter_Kalman_Matrix_Struct *pData, double *x, double *P, const float *z)
+{
+  enum {S_MAX = FILT_KALM_MATRIX_MAX_SIZE};
+  uint32_t n = pData->states, m = pData->measurements;
+  double v[S_MAX], T[S_MAX * S_MAX], S[S_MAX * S_MAX], PHt[S_MAX * S_MAX], K[S_MAX * S_MAX];
+
+  // x = F * x, P = F * P * F' + Q
+  for(uint32_t i = 0; i < n; i++)
+  {
+    v[i] = 0.0;
+    for(uint32_t k = 0; k < n; k++)
+    {
+      v[i] += pData->F[i * n + k] * x[k];
+    }
+  }
+  memcpy(x, v, n * sizeof(double));
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t j = 0; j < n; j++)
+    {
+      T[i * n + j] = 0.0;
+      for(uint32_t k = 0; k < n; k++)
+      {
+        T[i * n + j] += pData->F[i * n + k] * P[k * n + j];
+      }
+    }
+  }
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t j = 0; j < n; j++)
+    {
+      P[i * n + j] = pData->Q[i * n + j];
+      for(uint32_t k = 0; k < n; k++)
+      {
+        P[i * n + j] += T[i * n + k] * pData->F[j * n + k];
+      }
+    }
+  }
+
+  // S = H * P * H' + R, K = P * H' * S^-1
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t j = 0; j < m; j++)
+    {
+      PHt[i * m + j] = 0.0;
+      for(uint32_t k = 0; k < n; k++)
+      {
+        PHt[i * m + j] += P[i * n + k] * pData->H[j * n + k];
+      }
+    }
+  }
+  for(uint32_t i = 0; i < m; i++)
+  {
+    for(uint32_t j = 0; j < m; j++)
+    {
+      S[i * m + j] = pData->R[i * m + j];
+      for(uint32_t k = 0; k < n; k++)
+      {
+        S[i * m + j] += pData->H[i * n + k] * PHt[k * m + j];
+      }
+    }
+  }
+  Test_Matrix_Inverse(S, m);
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t j = 0; j < m; j++)
+    {
+      K[i * m + j] = 0.0;
+      for(uint32_t k = 0; k < m; k++)
+      {
+        K[i * m + j] += PHt[i * m + k] * S[k * m + j];
+      }
+    }
+  }
+
+  // x = x + K * (z - H * x), P = P - K * (P * H')'
+  for(uint32_t i = 0; i < m; i++)
+  {
+    v[i] = z[i];
+    for(uint32_t k = 0; k < n; k++)
+    {
+      v[i] -= pData->H[i * n + k] * x[k];
+    }
+  }
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t k = 0; k < m; k++)
+    {
+      x[i] += K[i * m + k] * v[k];
+    }
+  }
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t j = 0; j < n; j++)
+    {
+      T[i * n + j] = P[i * n + j];
+      for(uint32_t k = 0; k < m; k++)
+      {
+        T[i * n + j] -= K[i * m + k] * PHt[j * m + k];
+      }
+    }
+  }
+  // the standard form loses the symmetry, it is restored
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t j = 0; j < n; j++)
+    {
+      P[i * n + j] = 0.5 * (T[i * n + j] + T[j * n + i]);
+    }
+  }
+}
+
+/**
+  * @brief  The function fills a symmetric positive definite matrix:
+  *         A = B * B' + diagonal * I with a random B
+  * @param  A a pointer on the matrix (m x m)
+  * @param  m a size of the matrix
+  * @param  scale a scale of B
+  * @param  diagonal a value which is added to the diagonal
+  * @retval None
+  */
+static void Test_Matrix_Covariance(float *A, uint32_t m, double scale, double diagonal)
+{
+  double B[FILT_KALM_MATRIX_MAX_SIZE * FILT_KALM_MATRIX_MAX_SIZE];
+
+  for(uint32_t i = 0; i < m * m; i++)
+  {
+    B[i] = scale * Test_Matrix_Random();
+  }
+  for(uint32_t i = 0; i < m; i++)
+  {
+    for(uint32_t j = 0; j <= i; j++)
+    {
+      double sum = (i == j) ? diagonal : 0.0;
+      for(uint32_t k = 0; k < m; k++)
+      {
+        sum += B[i * m + k] * B[j * m + k];
+      }
+      A[i * m + j] = (float)sum;
+      A[j * m + i] = (float)sum;
+    }
+  }
+}
+
+/**
+  * @brief  The function runs the filter with a random model against the
+  *         reference and checks the symmetry of P after every step
+  * @param  n a number of values of the state
+  * @param  m a number of values of a measurement
+  * @retval None
+  */
+static void Test_Matrix_Model(uint32_t n, uint32_t m)
+{
+  float work[FILT_KALM_MATRIX_WORK_SIZE(FILT_KALM_MATRIX_MAX_SIZE, FILT_KALM_MATRIX_MAX_SIZE)];
+  double x[FILT_KALM_MATRIX_MAX_SIZE] = {0};
+  double P[FILT_KALM_MATRIX_MAX_SIZE * FILT_KALM_MATRIX_MAX_SIZE];
+  float truth[FILT_KALM_MATRIX_MAX_SIZE] = {0};
+  float next[FILT_KALM_MATRIX_MAX_SIZE];
+  float z[FILT_KALM_MATRIX_MAX_SIZE];
+  Filter_Kalman_Matrix_Struct filter;
+  double maxerror = 0.0, xmax = 1e-3;
+  size_t asymmetric = 0;
+
+  NON_HAL_TEST_CHECK(Filt_Kalm_Matrix_Init(&filter, work, n, m) == NON_HAL_OK, "%lu x %lu: init error",
+                     (unsigned long)n, (unsigned long)m);
+  // a stable model: F is near 0,99 * I, the process and the measurement
+  // noises are full covariances
+  for(uint32_t i = 0; i < n * n; i++)
+  {
+    filter.F[i] = (float)(((i % (n + 1U)) == 0 ? 0.99 : 0.0) + 0.01 * Test_Matrix_Random() / n);
+  }
+  for(uint32_t i = 0; i < m * n; i++)
+  {
+    filter.H[i] = (float)Test_Matrix_Random();
+  }
+  Test_Matrix_Covariance(filter.Q, n, 0.05, 1e-3);
+  Test_Matrix_Covariance(filter.R, m, 0.3, 0.05);
+  Test_Matrix_Covariance(filter.P, n, 1.0, 0.1);
+  for(uint32_t i = 0; i < n * n; i++)
+  {
+    P[i] = filter.P[i];
+  }
+
+  for(uint32_t step = 0; step < TEST_MATRIX_STEPS; step++)
+  {
+    double Pmax = 0.0, xerror = 0.0, Perror = 0.0;
+    // the true state follows the model with a noise, z is a noisy measurement of it
+    for(uint32_t i = 0; i < n; i++)
+    {
+      next[i] = 0.1f * (float)Test_Matrix_Random();
+      for(uint32_t k = 0; k < n; k++)
+      {
+        next[i] += filter.F[i * n + k] * truth[k];
+      }
+    }
+    memcpy(truth, next, n * sizeof(float));
+    for(uint32_t i = 0; i < m; i++)
+    {
+      z[i] = 0.3f * (float)Test_Matrix_Random();
+      for(uint32_t k = 0; k < n; k++)
+      {
+        z[i] += filter.H[i * n + k] * truth[k];
+      }
+    }
+
+    Test_Matrix_Reference(&filter, x, P, z);
+    NON_HAL_TEST_CHECK(Filt_Kalm_Matrix(&filter, z) == NON_HAL_OK, "%lu x %lu: update error",
+                       (unsigned long)n, (unsigned long)m);
+    for(uint32_t i = 0; i < n; i++)
+    {
+      xmax = fmax(xmax, fabs(x[i]));
+      xerror = fmax(xerror, fabs(x[i] - filter.x[i]));
+    }
+    for(uint32_t i = 0; i < n * n; i++)
+    {
+      Pmax = fmax(Pmax, fabs(P[i]));
+      Perror = fmax(Perror, fabs(P[i] - filter.P[i]));
+      asymmetric += filter.P[i] != filter.P[(i % n) * n + i / n];
+    }
+    maxerror = fmax(maxerror, fmax(xerror / xmax, Perror / Pmax));
+  }
+  NON_HAL_TEST_CHECK(maxerror <= TEST_MATRIX_ERROR, "%lu x %lu: error %g", (unsigned long)n, (unsigned long)m,
+                     maxerror);
+  NON_HAL_TEST_CHECK(asymmetric == 0, "%lu x %lu: P isn't symmetric %zu times", (unsigned long)n,
+                     (unsigned long)m, asymmetric);
+}
+
+/**
+  * @brief  The main function of the test
+  * @retval EXIT_SUCCESS if all checks pass
+  */
+int main(void)
+{
+  double start;
+
+  Test_Matrix_Scalar();
+  start = Non_HAL_Test_Time();
+  for(size_t s = 0; s < sizeof(test_matrix_sizes) / sizeof(test_matrix_sizes[0]); s++)
+  {
+    Test_Matrix_Model(test_matrix_sizes[s][0], test_matrix_sizes[s][1]);
+  }
+  Non_HAL_Test_Report("Filt_Kalm_Matrix random models",
+                      TEST_MATRIX_STEPS * sizeof(test_matrix_sizes) / sizeof(test_matrix_sizes[0]),
+                      Non_HAL_Test_Time() - start);
+
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
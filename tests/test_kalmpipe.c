@@ -0,0 +1,275 @@
+/**
+  ******************************************************************************
+  * @file       test_kalmpipe.c
+  * @brief      The host test of the pipeline of the fast Kalman filters: several
+  *             producers against Filt_Kalm() channel by channel, no sample lost.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_lib.h"
+#include "non_hal_kalmpipe.h"
+#include "non_hal_test.h"
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of samples of each channel
+  */
+#define TEST_KALM_PIPE_SAMPLES     2000U
+
+/** @brief A number of channels
+  */
+#define TEST_KALM_PIPE_CHANNELS    61U
+
+/** @brief A number of producer threads, the producer p pushes the channels
+  *        p, p + TEST_KALM_PIPE_PRODUCERS, ...
+  */
+#define TEST_KALM_PIPE_PRODUCERS   4U
+
+/** @brief A number of samples in a queue, small to make the queues full
+  */
+#define TEST_KALM_PIPE_DEPTH       16U
+
+/** @brief A maximum number of results in a batch
+  */
+#define TEST_KALM_PIPE_BATCH       7U
+
+/* Types ---------------------------------------------------------------------*/
+
+/**
+  * @brief Results of the pipeline collected by the callback, a channel is
+  *        written only by its worker
+  */
+typedef struct
+{
+  float *output;                               /*!<Outputs of channels*/
+  uint32_t count[TEST_KALM_PIPE_CHANNELS];     /*!<A number of outputs of channels*/
+  uint32_t foreign[FILT_KALM_PIPE_MAX_WORKERS];  /*!<Results of channels of other workers*/
+  uint32_t range;                              /*!<A number of channels of one worker*/
+}Test_Kalm_Pipe_Results;
+
+/**
+  * @brief A producer thread
+  */
+typedef struct
+{
+  Filter_Kalman_Pipe_Struct *pipe;  /*!<The pipeline*/
+  const float *signal;              /*!<Samples of all channels*/
+  uint32_t index;                   /*!<A number of the producer*/
+  uint64_t pushed;                  /*!<A number of calls of Filt_Kalm_Pipe_Push()*/
+  uint64_t rejected;                /*!<A number of calls which returned NON_HAL_ERROR*/
+}Test_Kalm_Pipe_Producer;
+
+/* Variables -----------------------------------------------------------------*/
+
+/** @brief Numbers of workers and the first CPU of the workers
+  */
+static const int32_t test_kalm_pipe_workers[][2] = {{1, -1}, {3, -1}, {4, 0}, {8, 0}};
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The callback of the pipeline, it stores results by channels
+  * @param  context a pointer on the Test_Kalm_Pipe_Results structure
+  * @param  worker a number of the worker
+  * @param  results a pointer on the results
+  * @param  count a number of the results
+  * @retval None
+  */
+static void Test_Kalm_Pipe_Callback(void *context, uint32_t worker, const Filter_Kalman_Pipe_Sample *results,
+                                    uint32_t count)
+{
+  Test_Kalm_Pipe_Results *pResults = context;
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint32_t channel = results[i].channel;
+    if(channel / pResults->range != worker || pResults->count[channel] >= TEST_KALM_PIPE_SAMPLES)
+    {
+      pResults->foreign[worker]++;
+      continue;
+    }
+    pResults->output[channel * TEST_KALM_PIPE_SAMPLES + pResults->count[channel]++] = results[i].value;
+  }
+}
+
+/**
+  * @brief  The function of a producer thread, it pushes every sample of its
+  *         channels and pushes a sample again while its queue is full
+  * @param  arg a pointer on the Test_Kalm_Pipe_Producer structure
+  * @retval NULL
+  */
+static void *Test_Kalm_Pipe_Produce(void *arg)
+{
+  Test_Kalm_Pipe_Producer *pProducer = arg;
+
+  for(uint32_t n = 0; n < TEST_KALM_PIPE_SAMPLES; n++)
+  {
+    for(uint32_t c = pProducer->index; c < TEST_KALM_PIPE_CHANNELS; c += TEST_KALM_PIPE_PRODUCERS)
+    {
+      pProducer->pushed++;
+      while(Filt_Kalm_Pipe_Push(pProducer->pipe, c, pProducer->signal[c * TEST_KALM_PIPE_SAMPLES + n]) != NON_HAL_OK)
+      {
+        pProducer->rejected++;
+        pProducer->pushed++;
+        sched_yield();
+      }
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief  The function checks the pipeline with several producers: every
+  *         sample is filtered once by the worker of its channel, outputs of
+  *         a channel are the same bits as Filt_Kalm(), the pipeline counts
+  *         every call of Filt_Kalm_Pipe_Push() as filtered or dropped
+  * @param  signal a pointer on samples of all channels
+  * @param  workers a number of workers
+  * @param  cpu the first CPU of the workers, -1 for any
+  * @retval None
+  */
+static void Test_Kalm_Pipe(const float *signal, uint32_t workers, int32_t cpu)
+{
+  Filter_Kalman_Pipe_Struct *pipe = aligned_alloc(FILT_KALM_PIPE_LINE, sizeof(Filter_Kalman_Pipe_Struct));
+  Filter_Kalman_Pipe_Cell *cells = malloc(FILT_KALM_PIPE_CELLS_SIZE(workers, TEST_KALM_PIPE_DEPTH) *
+                                          sizeof(Filter_Kalman_Pipe_Cell));
+  Filter_Kalman_Pipe_Sample *samples = malloc(FILT_KALM_PIPE_RESULTS_SIZE(workers, TEST_KALM_PIPE_BATCH) *
+                                              sizeof(Filter_Kalman_Pipe_Sample));
+  Filter_Kalman_Struct filters[TEST_KALM_PIPE_CHANNELS];
+  Test_Kalm_Pipe_Producer producers[TEST_KALM_PIPE_PRODUCERS];
+  pthread_t threads[TEST_KALM_PIPE_PRODUCERS];
+  Test_Kalm_Pipe_Results results = {0};
+  uint64_t pushed = 0, rejected = 0, processed = 0;
+  size_t differs = 0, foreign = 0;
+  double start = Non_HAL_Test_Time();
+  char name[64];
+
+  snprintf(name, sizeof(name), "Filt_Kalm_Pipe %u workers", (unsigned)workers);
+  results.output = malloc(TEST_KALM_PIPE_CHANNELS * TEST_KALM_PIPE_SAMPLES * sizeof(float));
+  for(uint32_t c = 0; c < TEST_KALM_PIPE_CHANNELS; c++)
+  {
+    Filt_Kalm_Init(&filters[c], 0.1f, (c & 1U) ? 0.01f : 0.1f);
+  }
+  NON_HAL_TEST_CHECK(Filt_Kalm_Pipe_Init((Filter_Kalman_Pipe_Struct *)((char *)pipe + 16), filters,
+                                         TEST_KALM_PIPE_CHANNELS, workers, cells, TEST_KALM_PIPE_DEPTH, samples,
+                                         TEST_KALM_PIPE_BATCH, Test_Kalm_Pipe_Callback, &results) == NON_HAL_ERROR,
+                     "%s: misaligned structure accepted", name);
+  NON_HAL_TEST_CHECK(Filt_Kalm_Pipe_Init(pipe, filters, TEST_KALM_PIPE_CHANNELS, workers, cells,
+                                         TEST_KALM_PIPE_DEPTH, samples, TEST_KALM_PIPE_BATCH,
+                                         Test_Kalm_Pipe_Callback, &results) == NON_HAL_OK, "%s: init", name);
+  results.range = pipe->range;
+  NON_HAL_TEST_CHECK(Filt_Kalm_Pipe_Push(pipe, TEST_KALM_PIPE_CHANNELS, 0.0f) == NON_HAL_ERROR,
+                     "%s: channel out of range accepted", name);
+  NON_HAL_TEST_CHECK(Filt_Kalm_Pipe_Start(pipe, cpu) == NON_HAL_OK, "%s: start", name);
+
+  for(uint32_t p = 0; p < TEST_KALM_PIPE_PRODUCERS; p++)
+  {
+    producers[p] = (Test_Kalm_Pipe_Producer){pipe, signal, p, 0, 0};
+    if(pthread_create(&threads[p], NULL, Test_Kalm_Pipe_Produce, &producers[p]) != 0)
+    {
+      printf("FAIL: no thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for(uint32_t p = 0; p < TEST_KALM_PIPE_PRODUCERS; p++)
+  {
+    pthread_join(threads[p], NULL);
+    pushed += producers[p].pushed;
+    rejected += producers[p].rejected;
+  }
+  NON_HAL_TEST_CHECK(Filt_Kalm_Pipe_Stop(pipe) == NON_HAL_OK, "%s: stop", name);
+
+  for(uint32_t w = 0; w < pipe->workers; w++)
+  {
+    processed += pipe->worker[w].processed;
+    foreign += results.foreign[w];
+  }
+  for(uint32_t c = 0; c < TEST_KALM_PIPE_CHANNELS; c++)
+  {
+    Filter_Kalman_Struct filter;
+    Filt_Kalm_Init(&filter, 0.1f, (c & 1U) ? 0.01f : 0.1f);
+    NON_HAL_TEST_CHECK(results.count[c] == TEST_KALM_PIPE_SAMPLES, "%s, channel %u: %u outputs", name, c,
+                       results.count[c]);
+    for(uint32_t n = 0; n < results.count[c]; n++)
+    {
+      float output = Filt_Kalm(&filter, signal[c * TEST_KALM_PIPE_SAMPLES + n]);
+      differs += memcmp(&output, &results.output[c * TEST_KALM_PIPE_SAMPLES + n], sizeof(float)) != 0;
+    }
+    NON_HAL_TEST_CHECK(memcmp(&filter, &filters[c], sizeof(filter)) == 0, "%s, channel %u: state differs", name, c);
+  }
+  NON_HAL_TEST_CHECK(differs == 0, "%s: %zu outputs differ", name, differs);
+  NON_HAL_TEST_CHECK(foreign == 0, "%s: %zu results of other workers", name, foreign);
+  NON_HAL_TEST_CHECK(processed == (uint64_t)TEST_KALM_PIPE_CHANNELS * TEST_KALM_PIPE_SAMPLES,
+                     "%s: %llu samples processed", name, (unsigned long long)processed);
+  NON_HAL_TEST_CHECK(atomic_load(&pipe->dropped) == rejected, "%s: %lu dropped, %llu rejected", name,
+                     (unsigned long)atomic_load(&pipe->dropped), (unsigned long long)rejected);
+  NON_HAL_TEST_CHECK(processed + atomic_load(&pipe->dropped) == pushed, "%s: %llu pushed", name,
+                     (unsigned long long)pushed);
+
+  free(results.output);
+  free(samples);
+  free(cells);
+  free(pipe);
+  Non_HAL_Test_Report(name, processed, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The main function of the test
+  * @retval EXIT_SUCCESS if all checks pass
+  */
+int main(void)
+{
+  float *signal = malloc(TEST_KALM_PIPE_CHANNELS * TEST_KALM_PIPE_SAMPLES * sizeof(float));
+
+  for(uint32_t c = 0; c < TEST_KALM_PIPE_CHANNELS; c++)
+  {
+    for(uint32_t n = 0; n < TEST_KALM_PIPE_SAMPLES; n++)
+    {
+      float noise = (float)(Non_HAL_Test_Random() >> 40) / (float)(1U << 23) - 1.0f;
+      signal[c * TEST_KALM_PIPE_SAMPLES + n] = 0.5f * sinf((float)n * 0.01f + (float)c) + 0.1f * noise;
+    }
+  }
+  for(uint32_t i = 0; i < sizeof(test_kalm_pipe_workers) / sizeof(test_kalm_pipe_workers[0]); i++)
+  {
+    Test_Kalm_Pipe(signal, (uint32_t)test_kalm_pipe_workers[i][0], test_kalm_pipe_workers[i][1]);
+  }
+
+  free(signal);
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
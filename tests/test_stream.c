@@ -0,0 +1,275 @@
+/**
+  ******************************************************************************
+  * @file       test_stream.c
+  * @brief      The host test of the stream writer: everything which is
+  *             written to a linear or a ring buffer comes out of the flush
+  *             callback in order, with a synchronous output which sends only
+  *             a part of the data and with a DMA-like output which releases
+  *             the data from its completion callback.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "non_hal_lib.h"
+#include "non_hal_test.h"
+
+/* Types ---------------------------------------------------------------------*/
+
+/**
+  * @brief An output of a stream
+  */
+typedef struct
+{
+  Non_HAL_Stream_Struct *stream;  /*!<The stream of the output*/
+  uint8_t dma;                    /*!<0 - a synchronous partial write, 1 - a DMA-like transfer*/
+  uint8_t *data;                  /*!<Bytes which came out of the stream*/
+  size_t length;                  /*!<A number of bytes which came out of the stream*/
+  const uint8_t *pending;         /*!<Data of the running transfer (NULL - no transfer)*/
+  uint32_t pendinglength;         /*!<A number of bytes of the running transfer*/
+} Test_Stream_Output;
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A size of the buffer of a stream
+  */
+#define TEST_STREAM_SIZE      256U
+
+/** @brief A number of writes of a test
+  */
+#define TEST_STREAM_WRITES    20000U
+
+/** @brief A maximal number of bytes of one write
+  */
+#define TEST_STREAM_WRITE     40U
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The flush callback of the test: a synchronous output sends from 1
+  *         to length bytes, a DMA-like output starts a transfer
+  * @param  context a pointer on the Test_Stream_Output structure
+  * @param  data a pointer on data
+  * @param  length a number of bytes
+  * @retval a number of sent bytes (0 - the transfer is started)
+  */
+static uint32_t Test_Stream_Flush(void *context, const uint8_t *data, uint32_t length)
+{
+  Test_Stream_Output *pOutput = context;
+
+  NON_HAL_TEST_CHECK(length != 0, "flush: empty part");
+  if(pOutput->dma)
+  {
+    NON_HAL_TEST_CHECK(pOutput->pending == NULL, "flush: a transfer is already running");
+    pOutput->pending = data;
+    pOutput->pendinglength = length;
+    return 0;
+  }
+  uint32_t sent = 1U + (uint32_t)(Non_HAL_Test_Random() % length);
+  memcpy(&pOutput->data[pOutput->length], data, sent);
+  pOutput->length += sent;
+  return sent;
+}
+
+/**
+  * @brief  The transfer complete callback of a DMA-like output: it releases
+  *         the data and starts the next transfer, like an interrupt handler
+  * @param  pOutput a pointer on the Test_Stream_Output structure
+  * @retval None
+  */
+static void Test_Stream_Complete(Test_Stream_Output *pOutput)
+{
+  if(pOutput->pending == NULL)
+  {
+    return;
+  }
+  uint32_t length = pOutput->pendinglength;
+  memcpy(&pOutput->data[pOutput->length], pOutput->pending, length);
+  pOutput->length += length;
+  pOutput->pending = NULL;
+  Non_HAL_Stream_Release(pOutput->stream, length);
+  Non_HAL_Stream_Flush(pOutput->stream);
+}
+
+/**
+  * @brief  The function makes a random write to a stream
+  * @param  pStream a pointer on the stream
+  * @param  expected a pointer on an array for the bytes which the stream
+  *         accepts
+  * @param  length a pointer on a number of bytes in expected
+  * @retval the status of the write
+  */
+static NON_HAL_StatusTypeDef Test_Stream_Write(Non_HAL_Stream_Struct *pStream, uint8_t *expected, size_t *length)
+{
+  uint8_t data[TEST_STREAM_WRITE + 1];
+  uint32_t count = 0;
+  NON_HAL_StatusTypeDef status;
+  uint64_t random = Non_HAL_Test_Random();
+
+  switch(random % 6U)
+  {
+  case 0:
+  {
+    uint32_t value = (uint32_t)(random >> 32);
+    count = (uint32_t)snprintf((char *)data, sizeof(data), "%lu", (unsigned long)value);
+    status = Non_HAL_Stream_Put_UInt_32bit(pStream, value);
+    break;
+  }
+  case 1:
+  {
+    int32_t value = (int32_t)(random >> 32);
+    count = (uint32_t)snprintf((char *)data, sizeof(data), "%ld", (long)value);
+    status = Non_HAL_Stream_Put_Int_32bit(pStream, value);
+    break;
+  }
+  case 2:
+  {
+    float value = (float)((int32_t)(random >> 32)) * 1e-3f;
+    Non_HAL_CON_Float_to_DecString_Shortest(value, data, 16);
+    count = (uint32_t)strlen((const char *)data);
+    status = Non_HAL_Stream_Put_Float(pStream, value);
+    break;
+  }
+  case 3:
+  {
+    data[0] = (uint8_t)('a' + (random >> 40) % 26U);
+    count = 1;
+    status = Non_HAL_Stream_Put_Char(pStream, data[0]);
+    break;
+  }
+  case 4:
+  {
+    // a converter writes to a reserved space directly
+    int32_t value = (int32_t)(random >> 32);
+    uint8_t *space = Non_HAL_Stream_Reserve(pStream, 33);
+    Non_HAL_CON_Int_to_BinString_32bit(value, data, 33);
+    count = 32;
+    if(space != NULL)
+    {
+      Non_HAL_CON_Int_to_BinString_32bit(value, space, 33);
+    }
+    status = Non_HAL_Stream_Commit(pStream, 32);
+    break;
+  }
+  default:
+    count = 1U + (uint32_t)((random >> 32) % TEST_STREAM_WRITE);
+    for(uint32_t i = 0; i < count; i++)
+    {
+      data[i] = (uint8_t)Non_HAL_Test_Random();
+    }
+    status = Non_HAL_Stream_Write(pStream, data, count);
+    break;
+  }
+  if(status == NON_HAL_OK)
+  {
+    memcpy(&expected[*length], data, count);
+    *length += count;
+  }
+  return status;
+}
+
+/**
+  * @brief  The function checks that all accepted bytes of a stream come out
+  *         of its output in order and that rejected writes are counted
+  * @param  mode a mode of the buffer
+  * @param  dma 0 - a synchronous partial write, 1 - a DMA-like transfer
+  * @param  threshold a number of waiting bytes which starts a flush
+  * @retval None
+  */
+static void Test_Stream(Non_HAL_Stream_Mode mode, uint8_t dma, uint32_t threshold)
+{
+  uint8_t *buffer = Non_HAL_Test_Buffer(TEST_STREAM_SIZE);
+  uint8_t *expected = Non_HAL_Test_Buffer(TEST_STREAM_WRITES * TEST_STREAM_WRITE);
+  Non_HAL_Stream_Struct stream;
+  Test_Stream_Output output = {&stream, dma, Non_HAL_Test_Buffer(TEST_STREAM_WRITES * TEST_STREAM_WRITE), 0, NULL, 0};
+  size_t length = 0;
+  uint32_t rejected = 0;
+  double start = Non_HAL_Test_Time();
+  char name[40];
+
+  NON_HAL_TEST_CHECK(Non_HAL_Stream_Init(&stream, buffer, TEST_STREAM_SIZE, mode, threshold, Test_Stream_Flush,
+                                         &output) == NON_HAL_OK, "init error");
+  for(uint32_t i = 0; i < TEST_STREAM_WRITES; i++)
+  {
+    if(Test_Stream_Write(&stream, expected, &length) != NON_HAL_OK)
+    {
+      rejected++;
+    }
+    if(threshold == 0 && Non_HAL_Test_Random() % 4U == 0)
+    {
+      Non_HAL_Stream_Flush(&stream);
+    }
+    // the transfer completes at a random time
+    if(Non_HAL_Test_Random() % 3U == 0)
+    {
+      Test_Stream_Complete(&output);
+    }
+  }
+  Non_HAL_Stream_Flush(&stream);
+  while(output.pending != NULL)
+  {
+    Test_Stream_Complete(&output);
+  }
+
+  snprintf(name, sizeof(name), "%s, %s, threshold %lu", mode == NON_HAL_STREAM_RING ? "ring" : "linear",
+           dma ? "DMA" : "partial", (unsigned long)threshold);
+  NON_HAL_TEST_CHECK(stream.tail == stream.head && stream.flushed == stream.head,
+                     "%s: the stream isn't empty", name);
+  NON_HAL_TEST_CHECK(output.length == length && memcmp(output.data, expected, length) == 0,
+                     "%s: the output differs (%zu of %zu bytes)", name, output.length, length);
+  NON_HAL_TEST_CHECK(stream.dropped == rejected, "%s: dropped %lu, rejected %lu", name,
+                     (unsigned long)stream.dropped, (unsigned long)rejected);
+  NON_HAL_TEST_CHECK(dma || rejected == 0, "%s: a synchronous output rejected %lu writes", name,
+                     (unsigned long)rejected);
+  free(buffer);
+  free(expected);
+  free(output.data);
+  Non_HAL_Test_Report(name, TEST_STREAM_WRITES, Non_HAL_Test_Time() - start);
+}
+
+/**
+  * @brief  The main function of the test
+  * @retval EXIT_SUCCESS if all checks pass
+  */
+int main(void)
+{
+  for(uint8_t dma = 0; dma < 2; dma++)
+  {
+    Test_Stream(NON_HAL_STREAM_LINEAR, dma, 0);
+    Test_Stream(NON_HAL_STREAM_LINEAR, dma, 64);
+    Test_Stream(NON_HAL_STREAM_RING, dma, 0);
+    Test_Stream(NON_HAL_STREAM_RING, dma, 64);
+  }
+
+  printf("%s: %llu failed checks\n", non_hal_test_failed ? "FAILED" : "PASSED",
+         (unsigned long long)non_hal_test_failed);
+  return non_hal_test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,412 @@
+/**
+  ******************************************************************************
+  * @file       conv_sweep.c
+  * @brief      The driver which checks a float converter of non_hal_conv.c
+  *             with all 2^32 float bit patterns on all cores.
+  *
+  *             Usage: conv_sweep [-f dec|shortest] [-t threads] [-r first last]
+  *             dec      - Non_HAL_CON_Float_to_DecString() is compared with the
+  *                        exact value (8 significant digits, the error is half
+  *                        a unit of the 8th digit and the precision of
+  *                        float_const_table), the string must fit in a buffer
+  *                        of its length;
+  *             shortest - Non_HAL_CON_Float_to_DecString_Shortest() must
+  *                        convert back to the same bits with strtof().
+  *             The patterns are divided to chunks of 2^16 patterns, each
+  *             thread starts with an equal range of chunks and steals a half
+  *             of the largest range of other threads when its range is empty.
+  *             The failed patterns are counted by the binary exponent.
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "non_hal_conv.h"
+
+/* Types ---------------------------------------------------------------------*/
+
+/**
+  * @brief A check of one float bit pattern
+  */
+typedef bool (*Conv_Sweep_Check)(uint32_t bits);
+
+/**
+  * @brief A thread of the sweep with its range of chunks and its results
+  */
+typedef struct
+{
+  _Alignas(64) _Atomic uint64_t range;   /*!<The next chunk (high half) and the end chunk (low half)*/
+  uint64_t failed[256];                  /*!<Failed patterns by the biased exponent*/
+  uint32_t first_failed[256];            /*!<The first failed pattern by the biased exponent*/
+  uint64_t checked;                      /*!<A number of checked patterns*/
+  uint32_t stolen;                       /*!<A number of steals*/
+  pthread_t thread;                      /*!<The thread*/
+} Conv_Sweep_Worker;
+
+/* Variables -----------------------------------------------------------------*/
+
+static Conv_Sweep_Worker *conv_sweep_workers;
+static uint32_t conv_sweep_threads;
+static uint64_t conv_sweep_first;
+static uint64_t conv_sweep_last;
+static Conv_Sweep_Check conv_sweep_check;
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of bits of the number of patterns in a chunk
+  */
+#define CONV_SWEEP_CHUNK_BITS   16U
+
+/** @brief The range of chunks from NEXT to END (not included)
+  */
+#define CONV_SWEEP_RANGE(NEXT, END)   (((uint64_t)(NEXT) << 32) | (uint32_t)(END))
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function checks Non_HAL_CON_Float_to_DecString() with one
+  *         pattern
+  * @param  bits a float bit pattern
+  * @retval true if the string is right
+  */
+static bool Conv_Sweep_Check_Dec(uint32_t bits)
+{
+  uint8_t decstr[19];
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  if(Non_HAL_CON_Float_to_DecString(value, decstr, sizeof(decstr)) != NON_HAL_OK)
+  {
+    return false;
+  }
+  uint8_t size = (uint8_t)(strlen((char *)decstr) + 1);
+  if(Non_HAL_CON_Float_to_DecString(value, decstr, size - 1) != NON_HAL_ERROR)
+  {
+    return false;
+  }
+
+  uint32_t exponent = (bits >> 23) & 0xFFU;
+  if(exponent == 0xFFU)
+  {
+    return strcmp((char *)decstr, (bits & 0x007FFFFFU) ? "nan" : (bits >> 31) ? "-inf" : "+inf") == 0;
+  }
+  if(exponent == 0)
+  {
+    // subnormal numbers are 0
+    return strcmp((char *)decstr, "0") == 0;
+  }
+  double parsed = strtod((char *)decstr, NULL);
+  return fabs(parsed - (double)value) <= fabs((double)value) * (5.0e-8 + 3.8e-9) && !signbit(parsed) == !signbit(value);
+}
+
+/**
+  * @brief  The function checks Non_HAL_CON_Float_to_DecString_Shortest() with
+  *         one pattern
+  * @param  bits a float bit pattern
+  * @retval true if the string converts back to the same bits
+  */
+static bool Conv_Sweep_Check_Shortest(uint32_t bits)
+{
+  uint8_t decstr[16];
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  if(Non_HAL_CON_Float_to_DecString_Shortest(value, decstr, sizeof(decstr)) != NON_HAL_OK)
+  {
+    return false;
+  }
+  if(value != value)
+  {
+    return strcmp((char *)decstr, "nan") == 0;
+  }
+  float parsed = strtof((char *)decstr, NULL);
+  uint32_t parsed_bits;
+  memcpy(&parsed_bits, &parsed, sizeof(parsed_bits));
+  return parsed_bits == bits;
+}
+
+/**
+  * @brief  The function takes the next chunk of the range of a thread
+  * @param  pWorker a pointer on the thread
+  * @param  chunk a pointer on the taken chunk
+  * @retval true if a chunk is taken, false if the range is empty
+  */
+static bool Conv_Sweep_Take(Conv_Sweep_Worker *pWorker, uint32_t *chunk)
+{
+  uint64_t range = atomic_load(&pWorker->range);
+  for(;;)
+  {
+    uint32_t next = (uint32_t)(range >> 32), end = (uint32_t)range;
+    if(next >= end)
+    {
+      return false;
+    }
+    // a failed exchange reloads range, a thief may have taken the end of it
+    if(atomic_compare_exchange_weak(&pWorker->range, &range, CONV_SWEEP_RANGE(next + 1U, end)))
+    {
+      *chunk = next;
+      return true;
+    }
+  }
+}
+
+/**
+  * @brief  The function steals a half of the largest range of other threads
+  * @param  pWorker a pointer on the thread with an empty range
+  * @retval true if chunks are stolen, false if there is nothing to steal
+  */
+static bool Conv_Sweep_Steal(Conv_Sweep_Worker *pWorker)
+{
+  for(;;)
+  {
+    Conv_Sweep_Worker *victim = NULL;
+    uint64_t range = 0;
+    uint32_t largest = 1;
+    for(uint32_t i = 0; i < conv_sweep_threads; i++)
+    {
+      uint64_t candidate = atomic_load(&conv_sweep_workers[i].range);
+      uint32_t next = (uint32_t)(candidate >> 32), end = (uint32_t)candidate;
+      if(next < end && end - next > largest)
+      {
+        largest = end - next;
+        victim = &conv_sweep_workers[i];
+        range = candidate;
+      }
+    }
+    // a range of one chunk is left to its thread
+    if(victim == NULL)
+    {
+      return false;
+    }
+    uint32_t next = (uint32_t)(range >> 32), end = (uint32_t)range;
+    uint32_t middle = end - (end - next) / 2U;
+    if(atomic_compare_exchange_strong(&victim->range, &range, CONV_SWEEP_RANGE(next, middle)))
+    {
+      // nobody changes an empty range, so the thread stores its new range
+      atomic_store(&pWorker->range, CONV_SWEEP_RANGE(middle, end));
+      pWorker->stolen++;
+      return true;
+    }
+  }
+}
+
+/**
+  * @brief  The function of a thread: it checks its chunks and steals chunks
+  *         of other threads until all chunks are checked
+  * @param  argument a pointer on the thread
+  * @retval NULL
+  */
+static void *Conv_Sweep_Run(void *argument)
+{
+  Conv_Sweep_Worker *pWorker = argument;
+  uint32_t chunk;
+  do
+  {
+    while(Conv_Sweep_Take(pWorker, &chunk))
+    {
+      uint64_t first = (uint64_t)chunk << CONV_SWEEP_CHUNK_BITS;
+      uint64_t last = first + (1U << CONV_SWEEP_CHUNK_BITS) - 1U;
+      first = first > conv_sweep_first ? first : conv_sweep_first;
+      last = last < conv_sweep_last ? last : conv_sweep_last;
+      for(uint64_t pattern = first; pattern <= last; pattern++)
+      {
+        uint32_t bits = (uint32_t)pattern;
+        if(!conv_sweep_check(bits))
+        {
+          uint32_t exponent = (bits >> 23) & 0xFFU;
+          if(pWorker->failed[exponent]++ == 0 || bits < pWorker->first_failed[exponent])
+          {
+            pWorker->first_failed[exponent] = bits;
+          }
+        }
+      }
+      pWorker->checked += last - first + 1U;
+    }
+  } while(Conv_Sweep_Steal(pWorker));
+  return NULL;
+}
+
+/**
+  * @brief  The function returns the time of the monotonic clock
+  * @retval the time in seconds
+  */
+static double Conv_Sweep_Time(void)
+{
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+}
+
+/**
+  * @brief  The function prints the usage of the driver
+  * @param  name a name of the driver
+  * @retval EXIT_FAILURE
+  */
+static int Conv_Sweep_Usage(const char *name)
+{
+  printf("usage: %s [-f dec|shortest] [-t threads] [-r first last]\n", name);
+  return EXIT_FAILURE;
+}
+
+/**
+  * @brief  The driver of the sweep
+  * @param  argc a number of arguments
+  * @param  argv arguments, see the file description
+  * @retval EXIT_SUCCESS if all patterns are right
+  */
+int main(int argc, char **argv)
+{
+  const char *function = "dec";
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  conv_sweep_first = 0;
+  conv_sweep_last = UINT32_MAX;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+    {
+      function = argv[++i];
+    }
+    else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+    {
+      threads = strtol(argv[++i], NULL, 0);
+    }
+    else if(strcmp(argv[i], "-r") == 0 && i + 2 < argc)
+    {
+      conv_sweep_first = strtoull(argv[++i], NULL, 0);
+      conv_sweep_last = strtoull(argv[++i], NULL, 0);
+    }
+    else
+    {
+      return Conv_Sweep_Usage(argv[0]);
+    }
+  }
+  if(strcmp(function, "dec") == 0)
+  {
+    conv_sweep_check = Conv_Sweep_Check_Dec;
+    function = "Non_HAL_CON_Float_to_DecString";
+  }
+  else if(strcmp(function, "shortest") == 0)
+  {
+    conv_sweep_check = Conv_Sweep_Check_Shortest;
+    function = "Non_HAL_CON_Float_to_DecString_Shortest";
+  }
+  else
+  {
+    return Conv_Sweep_Usage(argv[0]);
+  }
+  if(threads < 1 || threads > 1024 || conv_sweep_first > conv_sweep_last || conv_sweep_last > UINT32_MAX)
+  {
+    return Conv_Sweep_Usage(argv[0]);
+  }
+
+  conv_sweep_threads = (uint32_t)threads;
+  conv_sweep_workers = aligned_alloc(_Alignof(Conv_Sweep_Worker), conv_sweep_threads * sizeof(Conv_Sweep_Worker));
+  if(conv_sweep_workers == NULL)
+  {
+    printf("no memory\n");
+    return EXIT_FAILURE;
+  }
+  memset(conv_sweep_workers, 0, conv_sweep_threads * sizeof(Conv_Sweep_Worker));
+
+  // equal ranges of chunks, the last thread takes the rest
+  uint32_t first_chunk = (uint32_t)(conv_sweep_first >> CONV_SWEEP_CHUNK_BITS);
+  uint32_t end_chunk = (uint32_t)((conv_sweep_last >> CONV_SWEEP_CHUNK_BITS) + 1U);
+  uint32_t share = (end_chunk - first_chunk) / conv_sweep_threads;
+  for(uint32_t i = 0; i < conv_sweep_threads; i++)
+  {
+    uint32_t next = first_chunk + i * share;
+    uint32_t end = i + 1U == conv_sweep_threads ? end_chunk : next + share;
+    atomic_init(&conv_sweep_workers[i].range, CONV_SWEEP_RANGE(next, end));
+  }
+
+  printf("%s: patterns 0x%08" PRIX64 "..0x%08" PRIX64 ", %" PRIu32 " threads\n", function, conv_sweep_first,
+         conv_sweep_last, conv_sweep_threads);
+  double start = Conv_Sweep_Time();
+  for(uint32_t i = 0; i < conv_sweep_threads; i++)
+  {
+    if(pthread_create(&conv_sweep_workers[i].thread, NULL, Conv_Sweep_Run, &conv_sweep_workers[i]) != 0)
+    {
+      printf("pthread_create failed\n");
+      return EXIT_FAILURE;
+    }
+  }
+  for(uint32_t i = 0; i < conv_sweep_threads; i++)
+  {
+    pthread_join(conv_sweep_workers[i].thread, NULL);
+  }
+  double seconds = Conv_Sweep_Time() - start;
+
+  uint64_t checked = 0, failed = 0, stolen = 0;
+  for(uint32_t i = 0; i < conv_sweep_threads; i++)
+  {
+    checked += conv_sweep_workers[i].checked;
+    stolen += conv_sweep_workers[i].stolen;
+  }
+  printf("%" PRIu64 " conversions in %.1f s, %.2f M conversions/s (%.2f M/s per thread), %" PRIu64 " steals\n",
+         checked, seconds, (double)checked / seconds * 1e-6, (double)checked / seconds * 1e-6 / conv_sweep_threads,
+         stolen);
+
+  // the histogram of failed patterns by the binary exponent
+  for(uint32_t exponent = 0; exponent < 256; exponent++)
+  {
+    uint64_t count = 0;
+    uint32_t first_failed = UINT32_MAX;
+    for(uint32_t i = 0; i < conv_sweep_threads; i++)
+    {
+      if(conv_sweep_workers[i].failed[exponent])
+      {
+        count += conv_sweep_workers[i].failed[exponent];
+        if(conv_sweep_workers[i].first_failed[exponent] < first_failed)
+        {
+          first_failed = conv_sweep_workers[i].first_failed[exponent];
+        }
+      }
+    }
+    if(count)
+    {
+      if(failed == 0)
+      {
+        printf("exponent  table  failed      first failed\n");
+      }
+      printf("%8d  %5" PRIu32 "  %10" PRIu64 "  0x%08" PRIX32 "\n", (int32_t)exponent - 127, exponent / 8U, count,
+             first_failed);
+      failed += count;
+    }
+  }
+  printf("%s: %" PRIu64 " failed patterns\n", failed ? "FAILED" : "PASSED", failed);
+  free(conv_sweep_workers);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,804 @@
+/**
+  ******************************************************************************
+  * @file       non_hal_bench.c
+  * @brief      The host benchmark of the converters and of the fast Kalman
+  *             filter: ns/op and bytes/op of each function for several
+  *             distributions of input values, as a table and as JSON.
+  *
+  *             Usage: non_hal_bench [-j file] [-t seconds] [-f filter]
+  *             -j file    - write the results as JSON to the file ("-" for
+  *                          stdout, then the table isn't printed);
+  *             -t seconds - the minimal time of one measurement (0.05 s by
+  *                          default), the best of three measurements is taken;
+  *             -f filter  - run only functions with the filter in the name.
+  *             Distributions: integers - small (|value| < 100) and full (all
+  *             the range); floats - normal (from 1e-3 to 1e6), subnormal and
+  *             huge (from 2^100 to the maximum); the filter - a noisy sine.
+  *             bytes/op is the length of the string which is written by
+  *             a converter or read by a parser, and the size of a sample and
+  *             a result of a filter. The array converters are measured per
+  *             value (16 values in one call).
+  *
+  * @author     darkyfoxy [*GitHub*](https://github.com/darkyfoxy)
+  * @version    0.01
+  * @date       17.10.2026
+  *
+  ******************************************************************************
+  * @copyright  <h3>Copyright (c) 2020 Pavlov V.</h3>
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "non_hal_conv.h"
+#include "non_hal_kalmfilter.h"
+
+/* Types ---------------------------------------------------------------------*/
+
+/**
+  * @brief Kinds of input values of a benchmark
+  */
+typedef enum
+{
+  BENCH_UNSIGNED = 0x0U,  /*!<Unsigned integers*/
+  BENCH_SIGNED   = 0x1U,  /*!<Signed integers*/
+  BENCH_FLOAT    = 0x2U,  /*!<Float values*/
+  BENCH_DOUBLE   = 0x3U,  /*!<Double values*/
+  BENCH_SIGNAL   = 0x4U   /*!<Samples of a noisy sine*/
+} Bench_Kind;
+
+/**
+  * @brief Strings which are prepared for a parser from the input values
+  */
+typedef enum
+{
+  BENCH_TEXT_NONE = 0x0U,  /*!<No strings*/
+  BENCH_TEXT_DEC  = 0x1U,  /*!<Decimal integers*/
+  BENCH_TEXT_HEX  = 0x2U,  /*!<Hexadecimal integers with 2 * bytes symbols*/
+  BENCH_TEXT_BIN  = 0x3U,  /*!<Binary integers with 8 * bytes symbols*/
+  BENCH_TEXT_REAL = 0x4U   /*!<The shortest round-trip strings of float or double values*/
+} Bench_Text;
+
+/**
+  * @brief A function of a benchmark: it runs the measured function with the
+  *        index-th input value
+  */
+typedef size_t (*Bench_Function)(uint32_t index);
+
+/**
+  * @brief A benchmark of one function
+  */
+typedef struct
+{
+  const char *name;       /*!<A name of the measured function*/
+  Bench_Function run;     /*!<The function of the benchmark, it returns bytes*/
+  Bench_Kind kind;        /*!<A kind of input values*/
+  uint8_t bytes;          /*!<A size of an integer input value (1, 2, 4 or 8)*/
+  Bench_Text text;        /*!<Strings for a parser*/
+  uint8_t values;         /*!<A number of values of one call*/
+} Bench_Case;
+
+/* Macros --------------------------------------------------------------------*/
+
+/** @brief A number of input values of a benchmark (a power of 2)
+  */
+#define BENCH_VALUES        4096U
+
+/** @brief A size of an input string and of an output string
+  */
+#define BENCH_TEXT_SIZE     80U
+
+/** @brief A number of values of one call of an array converter
+  */
+#define BENCH_ARRAY         16U
+
+/** @brief A number of measurements of a benchmark, the best one is taken
+  */
+#define BENCH_REPEATS       3U
+
+#ifndef NON_HAL_BENCH_VERSION
+/** @brief A version of the library in the JSON (set by tools/CMakeLists.txt)
+  */
+#define NON_HAL_BENCH_VERSION   "unknown"
+#endif
+
+#ifndef NON_HAL_BENCH_COMPILER
+/** @brief A compiler of the library in the JSON (set by tools/CMakeLists.txt)
+  */
+#define NON_HAL_BENCH_COMPILER  "unknown"
+#endif
+
+#ifndef NON_HAL_BENCH_BUILD
+/** @brief A build type of the library in the JSON (set by tools/CMakeLists.txt)
+  */
+#define NON_HAL_BENCH_BUILD     "unknown"
+#endif
+
+/* Variables -----------------------------------------------------------------*/
+
+static uint64_t bench_integer[BENCH_VALUES + BENCH_ARRAY];
+static float bench_float[BENCH_VALUES];
+static double bench_double[BENCH_VALUES];
+static uint8_t bench_text[BENCH_VALUES][BENCH_TEXT_SIZE];
+static uint32_t bench_u32[BENCH_VALUES + BENCH_ARRAY];
+static uint8_t bench_u8[BENCH_VALUES + BENCH_ARRAY];
+static uint8_t bench_out[BENCH_TEXT_SIZE * BENCH_ARRAY];
+static float bench_block[BENCH_VALUES];
+static Filter_Kalman_Struct bench_kalman;
+static Filter_Kalman_Q15_Struct bench_kalman_q15;
+static Filter_Kalman_Q31_Struct bench_kalman_q31;
+static uint64_t bench_seed = 88172645463325252ULL;
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function returns the next pseudo-random value (xorshift64)
+  * @retval a pseudo-random uint64_t value
+  */
+static uint64_t Bench_Random(void)
+{
+  bench_seed ^= bench_seed << 13;
+  bench_seed ^= bench_seed >> 7;
+  bench_seed ^= bench_seed << 17;
+  return bench_seed;
+}
+
+/**
+  * @brief  The function returns the time of the monotonic clock
+  * @retval the time in seconds
+  */
+static double Bench_Time(void)
+{
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+}
+
+/**
+  * @brief  The function returns a length of the output string
+  * @retval a number of symbols without \0
+  */
+static size_t Bench_Out_Length(void)
+{
+  return strlen((const char *)bench_out);
+}
+
+/* Benchmarks of the converters to a string ----------------------------------*/
+
+static size_t Bench_Int_to_BinString_8bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_BinString_8bit((int8_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Int_to_BinString_16bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_BinString_16bit((int16_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Int_to_BinString_32bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_BinString_32bit((int32_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Int_to_BinString_64bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_BinString_64bit((int64_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_HexString_8bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_HexString_8bit((uint8_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_HexString_16bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_HexString_16bit((uint16_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_HexString_32bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_HexString_32bit((uint32_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_HexString_64bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_HexString_64bit(bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_DecString_8bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_DecString_8bit((uint8_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Int_to_DecString_8bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_DecString_8bit((int8_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_DecString_32bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_DecString_32bit((uint32_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Int_to_DecString_32bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_DecString_32bit((int32_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_DecString_64bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_DecString_64bit(bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Int_to_DecString_64bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_DecString_64bit((int64_t)bench_integer[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_to_DecString_Padded_32bit(uint32_t i)
+{
+  Non_HAL_CON_UInt_to_DecString_Padded_32bit((uint32_t)bench_integer[i], 10, bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Int_to_DecString_Padded_32bit(uint32_t i)
+{
+  Non_HAL_CON_Int_to_DecString_Padded_32bit((int32_t)bench_integer[i], 10, bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Float_to_DecString(uint32_t i)
+{
+  Non_HAL_CON_Float_to_DecString(bench_float[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Float_to_DecString_Shortest(uint32_t i)
+{
+  Non_HAL_CON_Float_to_DecString_Shortest(bench_float[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Float_to_DecString_Format(uint32_t i)
+{
+  Non_HAL_CON_Float_to_DecString_Format(bench_float[i], 2, NON_HAL_CON_AUTO, bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_Double_to_DecString_Shortest(uint32_t i)
+{
+  Non_HAL_CON_Double_to_DecString_Shortest(bench_double[i], bench_out, BENCH_TEXT_SIZE);
+  return Bench_Out_Length();
+}
+
+static size_t Bench_UInt_Array_to_DecString_32bit(uint32_t i)
+{
+  uint32_t length = 0;
+  Non_HAL_CON_UInt_Array_to_DecString_32bit(&bench_u32[i], BENCH_ARRAY, ',', bench_out, sizeof(bench_out), &length);
+  return length;
+}
+
+static size_t Bench_Int_Array_to_DecString_32bit(uint32_t i)
+{
+  uint32_t length = 0;
+  Non_HAL_CON_Int_Array_to_DecString_32bit((const int32_t *)&bench_u32[i], BENCH_ARRAY, ',', bench_out,
+                                           sizeof(bench_out), &length);
+  return length;
+}
+
+static size_t Bench_UInt_Array_to_HexString_8bit(uint32_t i)
+{
+  uint32_t length = 0;
+  Non_HAL_CON_UInt_Array_to_HexString_8bit(&bench_u8[i], BENCH_ARRAY, 0, bench_out, sizeof(bench_out), &length);
+  return length;
+}
+
+static size_t Bench_UInt_Array_to_HexString_32bit(uint32_t i)
+{
+  uint32_t length = 0;
+  Non_HAL_CON_UInt_Array_to_HexString_32bit(&bench_u32[i], BENCH_ARRAY, ' ', bench_out, sizeof(bench_out), &length);
+  return length;
+}
+
+/* Benchmarks of the converters from a string --------------------------------*/
+
+static size_t Bench_BinString_to_Int_8bit(uint32_t i)
+{
+  int8_t data;
+  Non_HAL_CON_BinString_to_Int_8bit(bench_text[i], &data);
+  return strlen((const char *)bench_text[i]);
+}
+
+static size_t Bench_BinString_to_Int_16bit(uint32_t i)
+{
+  int16_t data;
+  Non_HAL_CON_BinString_to_Int_16bit(bench_text[i], &data);
+  return strlen((const char *)bench_text[i]);
+}
+
+static size_t Bench_BinString_to_Int_32bit(uint32_t i)
+{
+  int32_t data;
+  Non_HAL_CON_BinString_to_Int_32bit(bench_text[i], &data);
+  return strlen((const char *)bench_text[i]);
+}
+
+static size_t Bench_BinString_to_Int_64bit(uint32_t i)
+{
+  int64_t data;
+  Non_HAL_CON_BinString_to_Int_64bit(bench_text[i], &data);
+  return strlen((const char *)bench_text[i]);
+}
+
+static size_t Bench_HexString_to_UInt_8bit(uint32_t i)
+{
+  uint8_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_HexString_to_UInt_8bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_HexString_to_UInt_16bit(uint32_t i)
+{
+  uint16_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_HexString_to_UInt_16bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_HexString_to_UInt_32bit(uint32_t i)
+{
+  uint32_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_HexString_to_UInt_32bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_HexString_to_UInt_64bit(uint32_t i)
+{
+  uint64_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_HexString_to_UInt_64bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_DecString_to_UInt_32bit(uint32_t i)
+{
+  uint32_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_DecString_to_UInt_32bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_DecString_to_Int_32bit(uint32_t i)
+{
+  int32_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_DecString_to_Int_32bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_DecString_to_UInt_64bit(uint32_t i)
+{
+  uint64_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_DecString_to_UInt_64bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_DecString_to_Int_64bit(uint32_t i)
+{
+  int64_t data;
+  uint32_t length = 0;
+  Non_HAL_CON_DecString_to_Int_64bit(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_DecString_to_Float(uint32_t i)
+{
+  float data;
+  uint32_t length = 0;
+  Non_HAL_CON_DecString_to_Float(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+static size_t Bench_DecString_to_Double(uint32_t i)
+{
+  double data;
+  uint32_t length = 0;
+  Non_HAL_CON_DecString_to_Double(bench_text[i], BENCH_TEXT_SIZE, &data, &length);
+  return length;
+}
+
+/* Benchmarks of the fast Kalman filter --------------------------------------*/
+
+static size_t Bench_Filt_Kalm(uint32_t i)
+{
+  bench_block[i] = Filt_Kalm(&bench_kalman, bench_float[i]);
+  return 2 * sizeof(float);
+}
+
+static size_t Bench_Filt_Kalm_Block(uint32_t i)
+{
+  // one call filters all samples, the other calls of the pass do nothing
+  if(i == 0)
+  {
+    Filt_Kalm_Block(&bench_kalman, bench_float, bench_block, BENCH_VALUES);
+  }
+  return 2 * sizeof(float);
+}
+
+static size_t Bench_Filt_Kalm_Q15(uint32_t i)
+{
+  bench_u32[i] = (uint32_t)Filt_Kalm_Q15(&bench_kalman_q15, (int16_t)bench_integer[i]);
+  return 2 * sizeof(int16_t);
+}
+
+static size_t Bench_Filt_Kalm_Q31(uint32_t i)
+{
+  bench_u32[i] = (uint32_t)Filt_Kalm_Q31(&bench_kalman_q31, (int32_t)bench_integer[i]);
+  return 2 * sizeof(int32_t);
+}
+
+/* Constants -----------------------------------------------------------------*/
+
+/** @brief All benchmarks
+  */
+static const Bench_Case bench_cases[] =
+{
+  {"Non_HAL_CON_Int_to_BinString_8bit",            Bench_Int_to_BinString_8bit,          BENCH_SIGNED,   1, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Int_to_BinString_16bit",           Bench_Int_to_BinString_16bit,         BENCH_SIGNED,   2, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Int_to_BinString_32bit",           Bench_Int_to_BinString_32bit,         BENCH_SIGNED,   4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Int_to_BinString_64bit",           Bench_Int_to_BinString_64bit,         BENCH_SIGNED,   8, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_HexString_8bit",           Bench_UInt_to_HexString_8bit,         BENCH_UNSIGNED, 1, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_HexString_16bit",          Bench_UInt_to_HexString_16bit,        BENCH_UNSIGNED, 2, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_HexString_32bit",          Bench_UInt_to_HexString_32bit,        BENCH_UNSIGNED, 4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_HexString_64bit",          Bench_UInt_to_HexString_64bit,        BENCH_UNSIGNED, 8, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_DecString_8bit",           Bench_UInt_to_DecString_8bit,         BENCH_UNSIGNED, 1, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Int_to_DecString_8bit",            Bench_Int_to_DecString_8bit,          BENCH_SIGNED,   1, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_DecString_32bit",          Bench_UInt_to_DecString_32bit,        BENCH_UNSIGNED, 4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Int_to_DecString_32bit",           Bench_Int_to_DecString_32bit,         BENCH_SIGNED,   4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_DecString_64bit",          Bench_UInt_to_DecString_64bit,        BENCH_UNSIGNED, 8, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Int_to_DecString_64bit",           Bench_Int_to_DecString_64bit,         BENCH_SIGNED,   8, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_to_DecString_Padded_32bit",   Bench_UInt_to_DecString_Padded_32bit, BENCH_UNSIGNED, 4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Int_to_DecString_Padded_32bit",    Bench_Int_to_DecString_Padded_32bit,  BENCH_SIGNED,   4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Float_to_DecString",               Bench_Float_to_DecString,             BENCH_FLOAT,    4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Float_to_DecString_Shortest",      Bench_Float_to_DecString_Shortest,    BENCH_FLOAT,    4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Float_to_DecString_Format",        Bench_Float_to_DecString_Format,      BENCH_FLOAT,    4, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_Double_to_DecString_Shortest",     Bench_Double_to_DecString_Shortest,   BENCH_DOUBLE,   8, BENCH_TEXT_NONE, 1},
+  {"Non_HAL_CON_UInt_Array_to_DecString_32bit",    Bench_UInt_Array_to_DecString_32bit,  BENCH_UNSIGNED, 4, BENCH_TEXT_NONE, BENCH_ARRAY},
+  {"Non_HAL_CON_Int_Array_to_DecString_32bit",     Bench_Int_Array_to_DecString_32bit,   BENCH_SIGNED,   4, BENCH_TEXT_NONE, BENCH_ARRAY},
+  {"Non_HAL_CON_UInt_Array_to_HexString_8bit",     Bench_UInt_Array_to_HexString_8bit,   BENCH_UNSIGNED, 1, BENCH_TEXT_NONE, BENCH_ARRAY},
+  {"Non_HAL_CON_UInt_Array_to_HexString_32bit",    Bench_UInt_Array_to_HexString_32bit,  BENCH_UNSIGNED, 4, BENCH_TEXT_NONE, BENCH_ARRAY},
+  {"Non_HAL_CON_BinString_to_Int_8bit",            Bench_BinString_to_Int_8bit,          BENCH_SIGNED,   1, BENCH_TEXT_BIN,  1},
+  {"Non_HAL_CON_BinString_to_Int_16bit",           Bench_BinString_to_Int_16bit,         BENCH_SIGNED,   2, BENCH_TEXT_BIN,  1},
+  {"Non_HAL_CON_BinString_to_Int_32bit",           Bench_BinString_to_Int_32bit,         BENCH_SIGNED,   4, BENCH_TEXT_BIN,  1},
+  {"Non_HAL_CON_BinString_to_Int_64bit",           Bench_BinString_to_Int_64bit,         BENCH_SIGNED,   8, BENCH_TEXT_BIN,  1},
+  {"Non_HAL_CON_HexString_to_UInt_8bit",           Bench_HexString_to_UInt_8bit,         BENCH_UNSIGNED, 1, BENCH_TEXT_HEX,  1},
+  {"Non_HAL_CON_HexString_to_UInt_16bit",          Bench_HexString_to_UInt_16bit,        BENCH_UNSIGNED, 2, BENCH_TEXT_HEX,  1},
+  {"Non_HAL_CON_HexString_to_UInt_32bit",          Bench_HexString_to_UInt_32bit,        BENCH_UNSIGNED, 4, BENCH_TEXT_HEX,  1},
+  {"Non_HAL_CON_HexString_to_UInt_64bit",          Bench_HexString_to_UInt_64bit,        BENCH_UNSIGNED, 8, BENCH_TEXT_HEX,  1},
+  {"Non_HAL_CON_DecString_to_UInt_32bit",          Bench_DecString_to_UInt_32bit,        BENCH_UNSIGNED, 4, BENCH_TEXT_DEC,  1},
+  {"Non_HAL_CON_DecString_to_Int_32bit",           Bench_DecString_to_Int_32bit,         BENCH_SIGNED,   4, BENCH_TEXT_DEC,  1},
+  {"Non_HAL_CON_DecString_to_UInt_64bit",          Bench_DecString_to_UInt_64bit,        BENCH_UNSIGNED, 8, BENCH_TEXT_DEC,  1},
+  {"Non_HAL_CON_DecString_to_Int_64bit",           Bench_DecString_to_Int_64bit,         BENCH_SIGNED,   8, BENCH_TEXT_DEC,  1},
+  {"Non_HAL_CON_DecString_to_Float",               Bench_DecString_to_Float,             BENCH_FLOAT,    4, BENCH_TEXT_REAL, 1},
+  {"Non_HAL_CON_DecString_to_Double",              Bench_DecString_to_Double,            BENCH_DOUBLE,   8, BENCH_TEXT_REAL, 1},
+  {"Filt_Kalm",                                    Bench_Filt_Kalm,                      BENCH_SIGNAL,   4, BENCH_TEXT_NONE, 1},
+  {"Filt_Kalm_Block",                              Bench_Filt_Kalm_Block,                BENCH_SIGNAL,   4, BENCH_TEXT_NONE, 1},
+  {"Filt_Kalm_Q15",                                Bench_Filt_Kalm_Q15,                  BENCH_SIGNAL,   2, BENCH_TEXT_NONE, 1},
+  {"Filt_Kalm_Q31",                                Bench_Filt_Kalm_Q31,                  BENCH_SIGNAL,   4, BENCH_TEXT_NONE, 1},
+};
+
+/** @brief Names of distributions of each kind of input values
+  */
+static const char *const bench_distributions[5][3] =
+{
+  {"small", "full", NULL},
+  {"small", "full", NULL},
+  {"normal", "subnormal", "huge"},
+  {"normal", "subnormal", "huge"},
+  {"noisy sine", NULL, NULL}
+};
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+  * @brief  The function prepares input values and strings of a benchmark
+  * @param  pCase a pointer on the benchmark
+  * @param  distribution an index of the distribution in bench_distributions
+  * @retval None
+  */
+static void Bench_Prepare(const Bench_Case *pCase, uint32_t distribution)
+{
+  uint32_t bits = pCase->bytes * 8U;
+  uint64_t mask = bits == 64 ? UINT64_MAX : (1ULL << bits) - 1U;
+  bench_seed = 88172645463325252ULL;
+
+  for(uint32_t i = 0; i < BENCH_VALUES + BENCH_ARRAY; i++)
+  {
+    uint64_t value = Bench_Random();
+    if(pCase->kind == BENCH_UNSIGNED || pCase->kind == BENCH_SIGNED)
+    {
+      if(distribution == 0)
+      {
+        // |value| < 100
+        value %= 100U;
+        if(pCase->kind == BENCH_SIGNED && (Bench_Random() & 1U))
+        {
+          value = 0U - value;
+        }
+      }
+      value &= mask;
+      // the sign bit of a signed value of a smaller type goes to all high bits
+      if(pCase->kind == BENCH_SIGNED && bits < 64 && (value >> (bits - 1U)))
+      {
+        value |= ~mask;
+      }
+    }
+    bench_integer[i] = value;
+    bench_u32[i] = (uint32_t)value;
+    bench_u8[i] = (uint8_t)value;
+  }
+
+  for(uint32_t i = 0; i < BENCH_VALUES; i++)
+  {
+    uint64_t random = Bench_Random();
+    double sign = (random & 1U) ? -1.0 : 1.0;
+    double fraction = (double)(random >> 11) * 0x1p-53;
+    if(pCase->kind == BENCH_FLOAT || pCase->kind == BENCH_DOUBLE)
+    {
+      if(distribution == 0)
+      {
+        // the decimal exponent is uniform from -3 to 6
+        bench_double[i] = sign * pow(10.0, -3.0 + 9.0 * fraction);
+      }
+      else if(distribution == 1)
+      {
+        bench_double[i] = pCase->kind == BENCH_FLOAT ? sign * 0x1p-126 * fraction : sign * 0x1p-1022 * fraction;
+      }
+      else
+      {
+        // the binary exponent is uniform from 100 to the maximum
+        double maximum = pCase->kind == BENCH_FLOAT ? 127.99 : 1023.99;
+        bench_double[i] = sign * pow(2.0, 100.0 + (maximum - 100.0) * fraction);
+      }
+      bench_float[i] = (float)bench_double[i];
+      if(distribution == 1 && pCase->kind == BENCH_FLOAT)
+      {
+        // the float is rounded from the subnormal range of double
+        bench_float[i] = (float)(sign * fraction) * 0x1p-126f;
+      }
+    }
+    else if(pCase->kind == BENCH_SIGNAL)
+    {
+      float sample = (float)(sin((double)i * 0.01) + 0.1 * (fraction - 0.5));
+      bench_float[i] = sample;
+      // Q15 and Q31 samples of a half of the full scale
+      bench_integer[i] = pCase->bytes == 2 ? (uint64_t)(int64_t)(int16_t)(sample * 16384.0f)
+                                           : (uint64_t)(int64_t)(int32_t)((double)sample * 1073741824.0);
+    }
+
+    char *text = (char *)bench_text[i];
+    switch(pCase->text)
+    {
+    case BENCH_TEXT_DEC:
+      if(pCase->kind == BENCH_SIGNED)
+      {
+        snprintf(text, BENCH_TEXT_SIZE, "%" PRId64, (int64_t)bench_integer[i]);
+      }
+      else
+      {
+        snprintf(text, BENCH_TEXT_SIZE, "%" PRIu64, bench_integer[i]);
+      }
+      break;
+    case BENCH_TEXT_HEX:
+      snprintf(text, BENCH_TEXT_SIZE, "%0*" PRIX64, (int)(2U * pCase->bytes), bench_integer[i] & mask);
+      break;
+    case BENCH_TEXT_BIN:
+      for(uint32_t bit = 0; bit < bits; bit++)
+      {
+        text[bit] = (char)('0' + ((bench_integer[i] >> (bits - 1U - bit)) & 1U));
+      }
+      text[bits] = 0;
+      break;
+    case BENCH_TEXT_REAL:
+      if(pCase->kind == BENCH_FLOAT)
+      {
+        Non_HAL_CON_Float_to_DecString_Shortest(bench_float[i], bench_text[i], BENCH_TEXT_SIZE);
+      }
+      else
+      {
+        Non_HAL_CON_Double_to_DecString_Shortest(bench_double[i], bench_text[i], BENCH_TEXT_SIZE);
+      }
+      break;
+    default:
+      text[0] = 0;
+      break;
+    }
+  }
+
+  Filt_Kalm_Init(&bench_kalman, 0.1f, 0.01f);
+  Filt_Kalm_Init_Q15(&bench_kalman_q15, 3277, 328);
+  Filt_Kalm_Init_Q31(&bench_kalman_q31, 214748365, 21474836);
+}
+
+/**
+  * @brief  The function measures a benchmark: passes over all input values
+  *         are repeated until the minimal time, the best of BENCH_REPEATS
+  *         measurements is taken
+  * @param  pCase a pointer on the benchmark
+  * @param  seconds the minimal time of one measurement
+  * @param  ns_per_op a pointer on the time of one value, ns
+  * @param  bytes_per_op a pointer on bytes of one value
+  * @retval a number of measured values
+  */
+static uint64_t Bench_Measure(const Bench_Case *pCase, double seconds, double *ns_per_op, double *bytes_per_op)
+{
+  uint64_t bytes = 0, total = 0;
+  // one pass to warm up caches and to count bytes
+  for(uint32_t i = 0; i < BENCH_VALUES; i++)
+  {
+    bytes += pCase->run(i);
+  }
+  *bytes_per_op = (double)bytes / ((double)BENCH_VALUES * pCase->values);
+  *ns_per_op = INFINITY;
+
+  for(uint32_t repeat = 0; repeat < BENCH_REPEATS; repeat++)
+  {
+    uint64_t passes = 0;
+    double start = Bench_Time(), elapsed;
+    do
+    {
+      for(uint32_t i = 0; i < BENCH_VALUES; i++)
+      {
+        pCase->run(i);
+      }
+      passes++;
+      elapsed = Bench_Time() - start;
+    } while(elapsed < seconds);
+    double ns = elapsed * 1e9 / ((double)passes * BENCH_VALUES * pCase->values);
+    *ns_per_op = ns < *ns_per_op ? ns : *ns_per_op;
+    total += passes * BENCH_VALUES * pCase->values;
+  }
+  return total;
+}
+
+/**
+  * @brief  The function prints the usage of the benchmark
+  * @param  name a name of the benchmark
+  * @retval EXIT_FAILURE
+  */
+static int Bench_Usage(const char *name)
+{
+  printf("usage: %s [-j file] [-t seconds] [-f filter]\n", name);
+  return EXIT_FAILURE;
+}
+
+/**
+  * @brief  The host benchmark
+  * @param  argc a number of arguments
+  * @param  argv arguments, see the file description
+  * @retval EXIT_SUCCESS
+  */
+int main(int argc, char **argv)
+{
+  const char *json_name = NULL;
+  const char *filter = NULL;
+  double seconds = 0.05;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+    {
+      json_name = argv[++i];
+    }
+    else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+    {
+      seconds = strtod(argv[++i], NULL);
+    }
+    else if(strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+    {
+      filter = argv[++i];
+    }
+    else
+    {
+      return Bench_Usage(argv[0]);
+    }
+  }
+
+  FILE *json = NULL;
+  bool table = true;
+  if(json_name != NULL)
+  {
+    table = strcmp(json_name, "-") != 0;
+    json = table ? fopen(json_name, "w") : stdout;
+    if(json == NULL)
+    {
+      printf("can't open %s\n", json_name);
+      return EXIT_FAILURE;
+    }
+    fprintf(json, "{\n  \"library\": \"non_hal\",\n  \"version\": \"%s\",\n  \"compiler\": \"%s\",\n"
+            "  \"build\": \"%s\",\n  \"results\": [", NON_HAL_BENCH_VERSION, NON_HAL_BENCH_COMPILER,
+            NON_HAL_BENCH_BUILD);
+  }
+  if(table)
+  {
+    printf("%-44s %-11s %9s %9s\n", "function", "input", "ns/op", "bytes/op");
+  }
+
+  bool first = true;
+  for(uint32_t c = 0; c < sizeof(bench_cases) / sizeof(bench_cases[0]); c++)
+  {
+    const Bench_Case *pCase = &bench_cases[c];
+    if(filter != NULL && strstr(pCase->name, filter) == NULL)
+    {
+      continue;
+    }
+    for(uint32_t d = 0; d < 3 && bench_distributions[pCase->kind][d] != NULL; d++)
+    {
+      double ns_per_op, bytes_per_op;
+      Bench_Prepare(pCase, d);
+      uint64_t ops = Bench_Measure(pCase, seconds, &ns_per_op, &bytes_per_op);
+      if(table)
+      {
+        printf("%-44s %-11s %9.2f %9.2f\n", pCase->name, bench_distributions[pCase->kind][d], ns_per_op,
+               bytes_per_op);
+      }
+      if(json != NULL)
+      {
+        fprintf(json, "%s\n    {\"name\": \"%s\", \"input\": \"%s\", \"ns_per_op\": %.3f, \"bytes_per_op\": %.3f, "
+                "\"ops\": %" PRIu64 "}", first ? "" : ",", pCase->name, bench_distributions[pCase->kind][d],
+                ns_per_op, bytes_per_op, ops);
+        first = false;
+      }
+    }
+  }
+
+  if(json != NULL)
+  {
+    fprintf(json, "\n  ]\n}\n");
+    if(json != stdout)
+    {
+      fclose(json);
+    }
+  }
+  return EXIT_SUCCESS;
+}